@@ -0,0 +1,67 @@
+using LibTrixi
+using Trixi
+using OrdinaryDiffEqLowStorageRK
+
+# The function to create the simulation state needs to be named `init_simstate`
+function init_simstate()
+
+    ###############################################################################
+    # semidiscretization of the linear advection equation with externally provided
+    # inflow boundary data
+
+    advection_velocity = (1.0, 0.5)
+    equations = LinearScalarAdvectionEquation2D(advection_velocity)
+
+    # Create DG solver with polynomial degree = 3 and (local) Lax-Friedrichs/Rusanov flux as surface flux
+    solver = DGSEM(polydeg=3, surface_flux=flux_lax_friedrichs)
+
+    coordinates_min = (-1.0, -1.0) # minimum coordinates (min(x), min(y))
+    coordinates_max = ( 1.0,  1.0) # maximum coordinates (max(x), max(y))
+
+    # Create a mesh with periodic boundaries in y-direction only
+    trees_per_dimension = (4, 4)
+    mesh = P4estMesh(trees_per_dimension, polydeg=3,
+                     coordinates_min=coordinates_min, coordinates_max=coordinates_max,
+                     initial_refinement_level=0, periodicity=(false, true))
+
+    # Inflow states are provided via `trixi_register_boundary_data`
+    boundary_conditions = Dict(
+        :x_neg => LibTrixiBoundaryCondition(),
+        :x_pos => BoundaryConditionDirichlet(initial_condition_constant))
+
+    # A semidiscretization collects data structures and functions for the spatial discretization
+    semi = SemidiscretizationHyperbolic(mesh, equations, initial_condition_constant, solver;
+                                        boundary_conditions = boundary_conditions)
+
+
+
+    ###############################################################################
+    # ODE solvers, callbacks etc.
+
+    # Create ODE problem with time span from 0.0 to 1.0
+    ode = semidiscretize(semi, (0.0, 1.0));
+
+    # At the beginning of the main loop, the SummaryCallback prints a summary of the simulation setup
+    # and resets the timers
+    summary_callback = SummaryCallback()
+
+    # The StepsizeCallback handles the re-calculation of the maximum Δt after each time step
+    stepsize_callback = StepsizeCallback(cfl=1.6)
+
+    # Create a CallbackSet to collect all callbacks such that they can be passed to the ODE solver
+    callbacks = CallbackSet(summary_callback, stepsize_callback)
+
+    # OrdinaryDiffEq's `integrator`
+    integrator = init(ode, CarpenterKennedy2N54(williamson_condition=false),
+                      dt=1.0, # solve needs some value here but it will be overwritten by the stepsize_callback ?!
+                      save_everystep=false, callback=callbacks);
+
+
+
+    ###############################################################################
+    # Create simulation state
+
+    simstate = SimulationState(semi, integrator)
+
+    return simstate
+end
@@ -0,0 +1,72 @@
+using LibTrixi
+using Trixi
+using OrdinaryDiffEqLowStorageRK
+
+# The function to create the simulation state needs to be named `init_simstate`
+function init_simstate()
+
+    ###############################################################################
+    # semidiscretization of the linear advection equation with mesh adaptation driven by
+    # an externally computed refinement indicator
+
+    advection_velocity = 1.0
+    equations = LinearScalarAdvectionEquation1D(advection_velocity)
+
+    # Create DG solver with polynomial degree = 3 and (local) Lax-Friedrichs/Rusanov flux as surface flux
+    solver = DGSEM(polydeg=3, surface_flux=flux_lax_friedrichs)
+
+    coordinates_min = -1.0 # minimum coordinate
+    coordinates_max =  1.0 # maximum coordinate
+
+    # Create a uniformly refined mesh with periodic boundaries
+    mesh = TreeMesh(coordinates_min, coordinates_max,
+                    initial_refinement_level = 4,
+                    n_cells_max = 30_000, periodicity = true)
+
+    # A semidiscretization collects data structures and functions for the spatial discretization
+    semi = SemidiscretizationHyperbolic(mesh, equations,
+                                        initial_condition_convergence_test, solver;
+                                        boundary_conditions = boundary_condition_periodic)
+
+
+
+    ###############################################################################
+    # ODE solvers, callbacks etc.
+
+    # Create ODE problem with time span from 0.0 to 1.0
+    ode = semidiscretize(semi, (0.0, 1.0));
+
+    # At the beginning of the main loop, the SummaryCallback prints a summary of the simulation setup
+    # and resets the timers
+    summary_callback = SummaryCallback()
+
+    # Elements with an indicator value above 0.5 are refined once, all others are coarsened
+    # back to the initial level. The indicator is set via `trixi_set_refinement_indicator`.
+    amr_controller = ControllerThreeLevel(semi, LibTrixiRefinementIndicator(),
+                                          base_level = 4, max_level = 5,
+                                          max_threshold = 0.5)
+
+    # The indicator is not available before the first time step
+    amr_callback = AMRCallback(semi, amr_controller, interval = 1,
+                               adapt_initial_condition = false)
+
+    # The StepsizeCallback handles the re-calculation of the maximum Δt after each time step
+    stepsize_callback = StepsizeCallback(cfl=1.6)
+
+    # Create a CallbackSet to collect all callbacks such that they can be passed to the ODE solver
+    callbacks = CallbackSet(summary_callback, amr_callback, stepsize_callback)
+
+    # OrdinaryDiffEq's `integrator`
+    integrator = init(ode, CarpenterKennedy2N54(williamson_condition=false),
+                      dt=1.0, # solve needs some value here but it will be overwritten by the stepsize_callback ?!
+                      save_everystep=false, callback=callbacks);
+
+
+
+    ###############################################################################
+    # Create simulation state
+
+    simstate = SimulationState(semi, integrator)
+
+    return simstate
+end
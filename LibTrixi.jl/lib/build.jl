@@ -56,6 +56,10 @@ header_files = [joinpath(dirname(dirname(@__DIR__)), "src", "trixi.h")]
 # - the other file contains the `init_julia`/`shutdown_julia` functions from PackageCompiler
 julia_init_c_file = ["init.c", PackageCompiler.default_julia_init()]
 
+# Workload run while building the library to record which methods need to be compiled, such
+# that the first calls to the API in applications do not suffer from JIT compilation
+precompile_execution_file = joinpath(@__DIR__, "precompile_execution.jl")
+
 # Extract version from `Project.toml`
 project_toml = joinpath(package_or_project_dir, "Project.toml")
 ctx = Pkg.Types.Context(env=Pkg.Types.EnvCache(project_toml))
@@ -81,6 +85,7 @@ include_transitive_dependencies = false
       force,
       header_files,
       julia_init_c_file,
+      precompile_execution_file,
       version,
       compat_level,
       include_lazy_artifacts,
@@ -94,6 +99,7 @@ lib_time = @elapsed PackageCompiler.create_library(package_or_project_dir, dest_
                                                    force,
                                                    header_files,
                                                    julia_init_c_file,
+                                                   precompile_execution_file,
                                                    version,
                                                    compat_level,
                                                    include_lazy_artifacts,
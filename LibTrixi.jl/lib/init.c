@@ -1,14 +1,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <julia.h>
 #include <julia_init.h>
 
+// Same header as bundled with the library via `header_files` in `build.jl`
+#include "../../src/trixi.h"
+
 // Track initialization/finalization status to prevent unhelpful errors
 static int is_initialized = 0;
 static int is_finalized = 0;
 
-void trixi_initialize(const char * project_directory__unused,
-                      const char * depot_path__unused) {
+// Wall clock times of the initialization phases
+static trixi_startup_times_t startup_times = {0};
+
+void trixi_initialize_with_threads(const char * project_directory__unused,
+                                   const char * depot_path__unused,
+                                   int nthreads, int ngcthreads) {
     // Prevent double initialization
     if (is_initialized) {
         fprintf(stderr, "ERROR in %s:%d (%s): %s\n", __FILE__, __LINE__, __func__,
@@ -33,19 +41,67 @@ void trixi_initialize(const char * project_directory__unused,
       printf("trixi_initialize: 'depot_path' is non-null but will not be used\n");
     }
 
+    // Set number of Julia threads and GC threads before initializing Julia
+    char value[32];
+    if (nthreads > 0) {
+      snprintf(value, 32, "%d", nthreads);
+      setenv("JULIA_NUM_THREADS", value, 1);
+      if (show_debug) {
+        printf("trixi_initialize: JULIA_NUM_THREADS set to \"%s\"\n", value);
+      }
+    }
+    if (ngcthreads > 0) {
+      snprintf(value, 32, "%d", ngcthreads);
+      setenv("JULIA_NUM_GC_THREADS", value, 1);
+      if (show_debug) {
+        printf("trixi_initialize: JULIA_NUM_GC_THREADS set to \"%s\"\n", value);
+      }
+    }
+
     // Init Julia (do not pass command line arguments)
+    const uint64_t time_start = jl_hrtime();
     int argc = 0;
     char** argv = NULL;
     init_julia(argc, argv);
 
+    // All packages are part of the library's system image and loaded by `init_julia`
+    startup_times.julia_init = 1.0e-9 * (jl_hrtime() - time_start);
+    startup_times.total = startup_times.julia_init;
+    startup_times.sysimage_packages = 1;
+
     if (show_debug) {
-      printf("trixi_initialize: Julia has been initialized\n");
+      printf("trixi_initialize: Julia has been initialized in %.3f s\n",
+             startup_times.julia_init);
     }
 
     // Mark as initialized
     is_initialized = 1;
 }
 
+void trixi_initialize(const char * project_directory__unused,
+                      const char * depot_path__unused) {
+    trixi_initialize_with_threads(project_directory__unused, depot_path__unused, 0, 0);
+}
+
+void trixi_initialize_with_sysimage(const char * project_directory__unused,
+                                    const char * depot_path__unused,
+                                    const char * sysimage_path__unused,
+                                    int nthreads, int ngcthreads) {
+    // The library itself is the system image, thus any other system image is ignored
+    const char * env = getenv("LIBTRIXI_DEBUG");
+    if (sysimage_path__unused != NULL && env != NULL &&
+        (strcmp(env, "all") == 0 || strcmp(env, "c") == 0)) {
+      printf("trixi_initialize: 'sysimage_path' is non-null but will not be used\n");
+    }
+
+    trixi_initialize_with_threads(project_directory__unused, depot_path__unused, nthreads,
+                                  ngcthreads);
+}
+
+void trixi_get_startup_times(trixi_startup_times_t * times) {
+    *times = startup_times;
+}
+
 void trixi_finalize() {
     // Prevent finalization without initialization and double finalization
     if (!is_initialized) {
@@ -64,3 +120,11 @@ void trixi_finalize() {
     // Mark as finalized
     is_finalized = 1;
 }
+
+int trixi_gc_safe_enter() {
+    return jl_gc_safe_enter(jl_current_task->ptls);
+}
+
+void trixi_gc_safe_leave(int state) {
+    jl_gc_safe_leave(jl_current_task->ptls, state);
+}
@@ -0,0 +1,273 @@
+# Representative workload executed by PackageCompiler.jl while building libtrixi, see
+# `build.jl`. All methods compiled while running this file are recorded and compiled into
+# the library, which removes the JIT compilation latency of the first calls to
+# `trixi_initialize_simulation`, `trixi_step` etc. in applications.
+#
+# The API functions are called with the same argument types as from C, such that the
+# recorded method instances are exactly those used when calling via the C interface. All
+# functions of the C API are covered except for those that cannot be called from within a
+# running Julia session (`trixi_initialize*`, `trixi_finalize`, `trixi_gc_safe_*`) and
+# `trixi_eval_julia`, which compiles arbitrary code anyway.
+
+using LibTrixi
+using Trixi
+
+# Libelixirs covering all spatial dimensions and mesh types as well as user-provided source
+# terms, refinement indicators, and boundary data, with the number of time steps for each.
+# The affect functions of the analysis, output, and AMR callbacks are already called during
+# initialization (initial analysis, initial solution, adaptation of the initial condition).
+# Only the first two libelixirs step past the intervals of these callbacks, i.e., the first
+# AMR and output interval (50) of the t8code libelixir and the analysis and output interval
+# (100) of the tree libelixir, such that mesh changes during time stepping are recorded as
+# well. The larger intervals of the other libelixirs would be too expensive to reach.
+const examples_dir = joinpath(dirname(pathof(LibTrixi)), "..", "examples")
+const libelixirs = ["libelixir_tree1d_advection_basic.jl" => 100,
+                    "libelixir_t8code2d_euler_tracer_amr.jl" => 50,
+                    "libelixir_p4est2d_euler_sedov.jl" => 5,
+                    "libelixir_t8code3d_euler_tracer.jl" => 5,
+                    "libelixir_tree1d_advection_source_terms.jl" => 5,
+                    "libelixir_tree1d_advection_amr.jl" => 2,
+                    "libelixir_p4est2d_advection_boundary_data.jl" => 5]
+
+# Callbacks passed to the API, they do not modify the simulation
+function source_terms_noop(time::Cdouble, u::Ptr{Cdouble}, du::Ptr{Cdouble},
+                           node_coordinates::Ptr{Cdouble}, nelements::Cint,
+                           userdata::Ptr{Cvoid})::Cvoid
+    return nothing
+end
+
+function mesh_change_noop(epoch::Cint, nelements_old::Cint, nelements_new::Cint,
+                          userdata::Ptr{Cvoid})::Cvoid
+    return nothing
+end
+
+
+# Registered boundary data is only referenced via pointers and must be kept alive
+const boundary_buffers = Vector{Vector{Cdouble}}()
+
+# Query and register data on all boundaries with names
+function run_boundary_workload(handle)
+    simstate = load_simstate(handle)
+    boundary_conditions = simstate.semi.boundary_conditions
+    if !(boundary_conditions isa Trixi.UnstructuredSortedBoundaryTypes)
+        return nothing
+    end
+
+    ndims = trixi_ndims(handle)
+    nvariables = trixi_nvariables(handle)
+    for (name, boundary_condition) in boundary_conditions.boundary_dictionary
+        name_c = string(name)
+        GC.@preserve name_c begin
+            name_ptr = Cstring(pointer(name_c))
+            nfaces = trixi_nboundary_faces(handle, name_ptr)
+            nnodes = nfaces * trixi_nnodes(handle)^(ndims - 1)
+            elements = zeros(Cint, nfaces)
+            coordinates = zeros(Cdouble, ndims * nnodes)
+            data = zeros(Cdouble, nnodes)
+            GC.@preserve elements coordinates data begin
+                trixi_load_boundary_face_elements(handle, name_ptr, pointer(elements))
+                trixi_load_boundary_node_coordinates(handle, name_ptr,
+                                                     pointer(coordinates))
+                trixi_load_boundary_conservative_var(handle, name_ptr, Cint(1),
+                                                     pointer(data))
+                trixi_load_boundary_primitive_var(handle, name_ptr, Cint(1),
+                                                  pointer(data))
+            end
+
+            if boundary_condition isa LibTrixiBoundaryCondition
+                boundary_data = zeros(Cdouble, nvariables * nnodes)
+                push!(boundary_buffers, boundary_data)
+                trixi_register_boundary_data(handle, name_ptr, pointer(boundary_data))
+            end
+        end
+    end
+
+    return nothing
+end
+
+
+function run_workload(libelixir, nsteps)
+    handle = trixi_initialize_simulation(libelixir)
+    simstate = load_simstate(handle)
+
+    # Size information
+    ndims = trixi_ndims(handle)
+    nelements = trixi_nelements(handle)
+    trixi_nelementsglobal(handle)
+    trixi_element_global_offset(handle)
+    ndofs = trixi_ndofs(handle)
+    trixi_ndofsglobal(handle)
+    ndofselement = trixi_ndofselement(handle)
+    nvariables = trixi_nvariables(handle)
+    nnodes = trixi_nnodes(handle)
+    trixi_mesh_epoch(handle)
+
+    # Registry entries, fields allocated before time stepping are transferred on mesh
+    # changes
+    if length(simstate.registry) > 0
+        registry_data = zeros(Cdouble, 1)
+        GC.@preserve registry_data begin
+            trixi_register_data(handle, Cint(1), Cint(1), pointer(registry_data))
+        end
+        trixi_registry_alloc(handle, Cint(1), Cint(1))
+        trixi_registry_get_pointer(handle, Cint(1))
+    end
+
+    # User-provided source terms, boundary data, and mesh change notifications
+    if simstate.semi.source_terms isa LibTrixiSourceTerms
+        trixi_register_source_terms(handle,
+                                    @cfunction(source_terms_noop, Cvoid,
+                                               (Cdouble, Ptr{Cdouble}, Ptr{Cdouble},
+                                                Ptr{Cdouble}, Cint, Ptr{Cvoid})),
+                                    C_NULL)
+    end
+    mesh, _, _, _ = Trixi.mesh_equations_solver_cache(simstate.semi)
+    if mesh isa Trixi.P4estMesh || mesh isa Trixi.T8codeMesh
+        run_boundary_workload(handle)
+    end
+    trixi_register_mesh_change_callback(handle,
+                                        @cfunction(mesh_change_noop, Cvoid,
+                                                   (Cint, Cint, Cint, Ptr{Cvoid})),
+                                        C_NULL)
+
+    # Time stepping
+    time = zeros(Cdouble, 1)
+    GC.@preserve time begin
+        trixi_is_finished(handle)
+        trixi_calculate_dt(handle)
+        if LibTrixi.find_refinement_indicator(simstate.integrator) === nothing
+            trixi_step(handle)
+            trixi_step_n(handle, Cint(nsteps - 1), pointer(time))
+        else
+            # The indicator has to be set again after each mesh change, alternately refine
+            # and coarsen all elements
+            for step in 1:nsteps
+                indicator = fill(Cdouble(isodd(step)), trixi_nelements(handle))
+                GC.@preserve indicator begin
+                    trixi_set_refinement_indicator(handle, pointer(indicator))
+                    trixi_step(handle)
+                end
+            end
+        end
+        trixi_advance_to_time(handle, trixi_get_simulation_time(handle), pointer(time))
+    end
+
+    # Data access, all buffers are sized for the current mesh
+    nelements = trixi_nelements(handle)
+    ndofs = trixi_ndofs(handle)
+    buffer = zeros(Cdouble, ndims * ndofs)
+    buffer_float = zeros(Cfloat, ndofs)
+    buffer_nodes = zeros(Cdouble, nnodes)
+    GC.@preserve buffer buffer_float buffer_nodes begin
+        trixi_load_node_reference_coordinates(handle, pointer(buffer_nodes))
+        trixi_load_node_weights(handle, pointer(buffer_nodes))
+        trixi_load_node_coordinates(handle, pointer(buffer))
+        trixi_load_conservative_var(handle, Cint(1), pointer(buffer))
+        trixi_store_conservative_var(handle, Cint(1), pointer(buffer))
+        trixi_load_conservative_var_float(handle, Cint(1), pointer(buffer_float))
+        trixi_load_primitive_var(handle, Cint(1), pointer(buffer))
+        trixi_load_primitive_var_float(handle, Cint(1), pointer(buffer_float))
+        trixi_load_element_averaged_primitive_var(handle, Cint(1), pointer(buffer))
+        trixi_load_element_averaged_primitive_var_float(handle, Cint(1),
+                                                        pointer(buffer_float))
+        trixi_get_conservative_vars_pointer(handle)
+        trixi_get_node_coordinates_pointer(handle)
+    end
+
+    # Multiple variables at once
+    buffers = [zeros(Cdouble, ndofs) for _ in 1:nvariables]
+    buffers_float = [zeros(Cfloat, ndofs) for _ in 1:nvariables]
+    pointers = pointer.(buffers)
+    pointers_float = pointer.(buffers_float)
+    variable_ids = Cint.(1:nvariables)
+    GC.@preserve buffers buffers_float pointers pointers_float variable_ids begin
+        trixi_load_conservative_vars(handle, Cint(nvariables), pointer(variable_ids),
+                                     pointer(pointers))
+        trixi_load_conservative_vars_float(handle, Cint(nvariables),
+                                           pointer(variable_ids), pointer(pointers_float))
+        trixi_load_primitive_vars(handle, Cint(nvariables), pointer(variable_ids),
+                                  pointer(pointers))
+        trixi_load_primitive_vars_float(handle, Cint(nvariables), pointer(variable_ids),
+                                        pointer(pointers_float))
+    end
+
+    # Subsets of elements
+    elements = Cint[1, nelements]
+    buffer_elements = zeros(Cdouble, length(elements) * ndofselement)
+    GC.@preserve elements buffer_elements begin
+        trixi_load_conservative_var_elements(handle, Cint(1), Cint(length(elements)),
+                                             pointer(elements), pointer(buffer_elements))
+        trixi_store_conservative_var_elements(handle, Cint(1), Cint(length(elements)),
+                                              pointer(elements), pointer(buffer_elements))
+        trixi_load_primitive_var_elements(handle, Cint(1), Cint(length(elements)),
+                                          pointer(elements), pointer(buffer_elements))
+    end
+
+    # State layout and complete state
+    layout = Ref{StateLayout}()
+    state = zeros(Cdouble, trixi_save_state_size(handle))
+    GC.@preserve layout state begin
+        trixi_get_state_layout(handle, Base.unsafe_convert(Ptr{StateLayout}, layout))
+        trixi_save_state(handle, pointer(state))
+        trixi_restore_state(handle, pointer(state))
+    end
+
+    # Reductions and probes
+    l2 = zeros(Cdouble, 1)
+    linf = zeros(Cdouble, 1)
+    points = zeros(Cdouble, ndims)
+    probe_data = zeros(Cdouble, nvariables)
+    GC.@preserve l2 linf points probe_data variable_ids begin
+        trixi_integrate_var(handle, Cint(1))
+        trixi_norm_var(handle, Cint(1), pointer(l2), pointer(linf))
+        trixi_minmax_var(handle, Cint(1), pointer(l2), pointer(linf))
+        probe = trixi_probe_create(handle, Cint(1), pointer(points))
+        trixi_probe_eval(handle, probe, Cint(nvariables), pointer(variable_ids),
+                         pointer(probe_data))
+        trixi_probe_free(handle, probe)
+    end
+
+    # Output, restarting requires an unchanged mesh
+    if LibTrixi.find_save_solution_callback(simstate.integrator) !== nothing
+        trixi_checkpoint_async(handle)
+        trixi_checkpoint_wait(handle)
+    end
+    if trixi_mesh_epoch(handle) == 0
+        restart_filename = "restart.bin"
+        trixi_write_restart(handle, restart_filename)
+        handle_restart = trixi_initialize_simulation_from_restart(libelixir,
+                                                                  restart_filename)
+        trixi_finalize_simulation(handle_restart)
+    end
+
+    # Mesh-specific functionality
+    if mesh isa Trixi.T8codeMesh
+        tree_ids = zeros(Cint, nelements)
+        local_ids = zeros(Cint, nelements)
+        GC.@preserve tree_ids local_ids begin
+            trixi_get_t8code_forest(handle)
+            trixi_load_element_tree_map(handle, pointer(tree_ids), pointer(local_ids))
+        end
+    end
+    if mesh isa Trixi.P4estMesh
+        weights = ones(Cdouble, nelements)
+        GC.@preserve weights trixi_rebalance(handle, pointer(weights))
+    end
+
+    trixi_finalize_simulation(handle)
+end
+
+
+# Version information
+trixi_version_library()
+trixi_version_julia()
+trixi_version_julia_extended()
+trixi_nthreads()
+
+# Run all libelixirs in a temporary directory to not pollute the build directory with output
+cd(mktempdir()) do
+    for (libelixir, nsteps) in libelixirs
+        @info "Running precompile workload for `$libelixir`..."
+        run_workload(joinpath(examples_dir, libelixir), nsteps)
+    end
+end
@@ -1,10 +1,12 @@
 module LibTrixi
 
-using SciMLBase: step!, check_error, successful_retcode, DiscreteCallback
+using SciMLBase: step!, check_error, successful_retcode, DiscreteCallback, add_tstop!,
+                 reinit!, set_proposed_dt!, u_modified!
 using Trixi: Trixi, summary_callback, mesh_equations_solver_cache, ndims, nelements,
              nelementsglobal, ndofs, ndofsglobal, nvariables, nnodes, wrap_array,
-             eachelement, cons2prim, get_node_vars, eachnode
+             eachelement, cons2prim, get_node_vars, eachnode, AbstractEquations, DG
 using MPI: MPI, run_init_hooks, set_default_error_handler_return
+using Mmap: Mmap
 using Pkg
 
 export trixi_initialize_simulation,
@@ -22,6 +24,36 @@ export trixi_is_finished,
 export trixi_step,
        trixi_step_cfptr,
        trixi_step_jl
+export trixi_step_n,
+       trixi_step_n_cfptr,
+       trixi_step_n_jl
+export trixi_advance_to_time,
+       trixi_advance_to_time_cfptr,
+       trixi_advance_to_time_jl
+export trixi_rebalance,
+       trixi_rebalance_cfptr,
+       trixi_rebalance_jl
+export trixi_save_state_size,
+       trixi_save_state_size_cfptr,
+       trixi_save_state_size_jl
+export trixi_save_state,
+       trixi_save_state_cfptr,
+       trixi_save_state_jl
+export trixi_restore_state,
+       trixi_restore_state_cfptr,
+       trixi_restore_state_jl
+export trixi_checkpoint_async,
+       trixi_checkpoint_async_cfptr,
+       trixi_checkpoint_async_jl
+export trixi_checkpoint_wait,
+       trixi_checkpoint_wait_cfptr,
+       trixi_checkpoint_wait_jl
+export trixi_write_restart,
+       trixi_write_restart_cfptr,
+       trixi_write_restart_jl
+export trixi_initialize_simulation_from_restart,
+       trixi_initialize_simulation_from_restart_cfptr,
+       trixi_initialize_simulation_from_restart_jl
 export trixi_ndims,
        trixi_ndims_cfptr,
        trixi_ndims_jl
@@ -31,6 +63,9 @@ export trixi_nelements,
 export trixi_nelementsglobal,
        trixi_nelementsglobal_cfptr,
        trixi_nelementsglobal_jl
+export trixi_element_global_offset,
+       trixi_element_global_offset_cfptr,
+       trixi_element_global_offset_jl
 export trixi_ndofs,
        trixi_ndofs_cfptr,
        trixi_ndofs_jl
@@ -52,24 +87,112 @@ export trixi_load_node_reference_coordinates,
 export trixi_load_node_weights,
        trixi_load_node_weights_cfptr,
        trixi_load_node_weights_jl
+export trixi_load_node_coordinates,
+       trixi_load_node_coordinates_cfptr,
+       trixi_load_node_coordinates_jl
 export trixi_load_conservative_var,
        trixi_load_conservative_var_cfptr,
        trixi_load_conservative_var_jl
+export trixi_load_conservative_var_float,
+       trixi_load_conservative_var_float_cfptr
+export trixi_load_conservative_vars,
+       trixi_load_conservative_vars_cfptr,
+       trixi_load_conservative_vars_jl
+export trixi_load_conservative_vars_float,
+       trixi_load_conservative_vars_float_cfptr
 export trixi_load_primitive_var,
        trixi_load_primitive_var_cfptr,
        trixi_load_primitive_var_jl
+export trixi_load_primitive_var_float,
+       trixi_load_primitive_var_float_cfptr
+export trixi_load_primitive_vars,
+       trixi_load_primitive_vars_cfptr,
+       trixi_load_primitive_vars_jl
+export trixi_load_primitive_vars_float,
+       trixi_load_primitive_vars_float_cfptr
 export trixi_load_element_averaged_primitive_var,
        trixi_load_element_averaged_primitive_var_cfptr,
        trixi_load_element_averaged_primitive_var_jl
+export trixi_load_element_averaged_primitive_var_float,
+       trixi_load_element_averaged_primitive_var_float_cfptr
 export trixi_store_conservative_var,
        trixi_store_conservative_var_cfptr,
        trixi_store_conservative_var_jl
+export trixi_load_conservative_var_elements,
+       trixi_load_conservative_var_elements_cfptr,
+       trixi_load_conservative_var_elements_jl
+export trixi_load_primitive_var_elements,
+       trixi_load_primitive_var_elements_cfptr,
+       trixi_load_primitive_var_elements_jl
+export trixi_store_conservative_var_elements,
+       trixi_store_conservative_var_elements_cfptr,
+       trixi_store_conservative_var_elements_jl
+export trixi_nboundary_faces,
+       trixi_nboundary_faces_cfptr,
+       trixi_nboundary_faces_jl
+export trixi_load_boundary_face_elements,
+       trixi_load_boundary_face_elements_cfptr,
+       trixi_load_boundary_face_elements_jl
+export trixi_load_boundary_node_coordinates,
+       trixi_load_boundary_node_coordinates_cfptr,
+       trixi_load_boundary_node_coordinates_jl
+export trixi_load_boundary_conservative_var,
+       trixi_load_boundary_conservative_var_cfptr,
+       trixi_load_boundary_conservative_var_jl
+export trixi_load_boundary_primitive_var,
+       trixi_load_boundary_primitive_var_cfptr,
+       trixi_load_boundary_primitive_var_jl
 export trixi_register_data,
        trixi_register_data_cfptr,
        trixi_register_data_jl
+export trixi_register_boundary_data,
+       trixi_register_boundary_data_cfptr,
+       trixi_register_boundary_data_jl
+export trixi_registry_alloc,
+       trixi_registry_alloc_cfptr,
+       trixi_registry_alloc_jl
+export trixi_registry_get_pointer,
+       trixi_registry_get_pointer_cfptr,
+       trixi_registry_get_pointer_jl
+export trixi_register_source_terms,
+       trixi_register_source_terms_cfptr,
+       trixi_register_source_terms_jl
+export trixi_set_refinement_indicator,
+       trixi_set_refinement_indicator_cfptr,
+       trixi_set_refinement_indicator_jl
+export trixi_mesh_epoch,
+       trixi_mesh_epoch_cfptr,
+       trixi_mesh_epoch_jl
+export trixi_register_mesh_change_callback,
+       trixi_register_mesh_change_callback_cfptr,
+       trixi_register_mesh_change_callback_jl
 export trixi_get_conservative_vars_pointer,
        trixi_get_conservative_vars_pointer_cfptr,
        trixi_get_conservative_vars_pointer_jl
+export trixi_get_node_coordinates_pointer,
+       trixi_get_node_coordinates_pointer_cfptr,
+       trixi_get_node_coordinates_pointer_jl
+export trixi_get_state_layout,
+       trixi_get_state_layout_cfptr,
+       trixi_get_state_layout_jl
+export trixi_integrate_var,
+       trixi_integrate_var_cfptr,
+       trixi_integrate_var_jl
+export trixi_norm_var,
+       trixi_norm_var_cfptr,
+       trixi_norm_var_jl
+export trixi_minmax_var,
+       trixi_minmax_var_cfptr,
+       trixi_minmax_var_jl
+export trixi_probe_create,
+       trixi_probe_create_cfptr,
+       trixi_probe_create_jl
+export trixi_probe_eval,
+       trixi_probe_eval_cfptr,
+       trixi_probe_eval_jl
+export trixi_probe_free,
+       trixi_probe_free_cfptr,
+       trixi_probe_free_jl
 export trixi_version_library,
        trixi_version_library_cfptr,
        trixi_version_library_jl
@@ -88,9 +211,14 @@ export trixi_version_julia,
 export trixi_version_julia_extended,
        trixi_version_julia_extended_cfptr,
        trixi_version_julia_extended_jl
+export trixi_nthreads,
+       trixi_nthreads_cfptr
 export trixi_get_t8code_forest,
        trixi_get_t8code_forest_cfptr,
        trixi_get_t8code_forest_jl
+export trixi_load_element_tree_map,
+       trixi_load_element_tree_map_cfptr,
+       trixi_load_element_tree_map_jl
 export trixi_eval_julia,
        trixi_eval_julia_cfptr,
        trixi_eval_julia_jl
@@ -99,7 +227,9 @@ export trixi_get_simulation_time,
        trixi_get_simulation_time_jl
 
 export SimulationState, store_simstate, load_simstate, delete_simstate!
-export LibTrixiDataRegistry
+export LibTrixiDataRegistry, LibTrixiSourceTerms, LibTrixiRefinementIndicator,
+       LibTrixiBoundaryCondition
+export StateLayout
 
 
 # global storage of name and version information of loaded packages
@@ -153,6 +283,17 @@ end
 
 
 include("simulationstate.jl")
+include("sourceterms.jl")
+include("refinementindicator.jl")
+include("boundaries.jl")
+include("snapshot.jl")
+include("checkpoint.jl")
+include("restart.jl")
+include("reductions.jl")
+include("probes.jl")
+include("meshchange.jl")
+include("registry.jl")
+include("rebalance.jl")
 include("api_c.jl")
 include("api_jl.jl")
 
@@ -119,6 +119,29 @@ trixi_version_julia_extended_cfptr() = @cfunction(trixi_version_julia_extended,
 
 
 
+############################################################################################
+# Threading                                                                                #
+############################################################################################
+
+"""
+    trixi_nthreads()::Cint
+
+Return the number of threads available to Julia for shared-memory parallelism, e.g., in
+`Trixi.@threaded` loops. The number of threads is fixed during Julia's initialization and
+can be set with `trixi_initialize_with_threads`.
+
+This function is thread-safe. It must be run after `trixi_initialize` has been called.
+"""
+function trixi_nthreads end
+
+Base.@ccallable function trixi_nthreads()::Cint
+    return Threads.nthreads()
+end
+
+trixi_nthreads_cfptr() = @cfunction(trixi_nthreads, Cint, ())
+
+
+
 ############################################################################################
 # Simulation control                                                                       #
 ############################################################################################
@@ -222,10 +245,266 @@ end
 trixi_step_cfptr() = @cfunction(trixi_step, Cvoid, (Cint,))
 
 
+"""
+    trixi_step_n(simstate_handle::Cint, nsteps::Cint, time::Ptr{Cdouble})::Cint
+
+Advance the simulation in time by up to `nsteps` steps and return the number of steps
+actually performed. Stepping stops early if the final time is reached.
+
+If `time` is not a null pointer, the physical time after the last step is stored in it.
+"""
+function trixi_step_n end
+
+Base.@ccallable function trixi_step_n(simstate_handle::Cint, nsteps::Cint,
+                                      time::Ptr{Cdouble})::Cint
+    simstate = load_simstate(simstate_handle)
+    nsteps_done = trixi_step_n_jl(simstate, nsteps)
+
+    if time != C_NULL
+        unsafe_store!(time, trixi_get_simulation_time_jl(simstate))
+    end
+
+    return nsteps_done
+end
+
+trixi_step_n_cfptr() = @cfunction(trixi_step_n, Cint, (Cint, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_advance_to_time(simstate_handle::Cint, target_time::Cdouble,
+                          time::Ptr{Cdouble})::Cint
+
+Advance the simulation in time until `target_time` is reached and return the number of steps
+actually performed. The integrator is forced to hit `target_time` exactly. Stepping stops
+early if the final time is reached.
+
+If `time` is not a null pointer, the physical time after the last step is stored in it.
+"""
+function trixi_advance_to_time end
+
+Base.@ccallable function trixi_advance_to_time(simstate_handle::Cint, target_time::Cdouble,
+                                               time::Ptr{Cdouble})::Cint
+    simstate = load_simstate(simstate_handle)
+    nsteps_done = trixi_advance_to_time_jl(simstate, target_time)
+
+    if time != C_NULL
+        unsafe_store!(time, trixi_get_simulation_time_jl(simstate))
+    end
+
+    return nsteps_done
+end
+
+trixi_advance_to_time_cfptr() =
+    @cfunction(trixi_advance_to_time, Cint, (Cint, Cdouble, Ptr{Cdouble}))
+
+
+"""
+    trixi_rebalance(simstate_handle::Cint, element_weights::Ptr{Cdouble})::Cint
+
+Repartition the mesh according to `element_weights` and return the new number of local
+elements.
+
+`element_weights` holds one non-negative weight per local element, e.g., the cost of
+additional computations performed for this element by the caller. The mesh is partitioned
+such that the sum of weights is balanced across all MPI ranks. The solution and the registry
+fields allocated by [`trixi_registry_alloc`](@ref) are moved to their new ranks and the mesh
+epoch is incremented (see [`trixi_mesh_epoch`](@ref)). This is a collective operation. It is
+only available for `P4estMesh` and does nothing in serial simulations.
+"""
+function trixi_rebalance end
+
+Base.@ccallable function trixi_rebalance(simstate_handle::Cint,
+                                         element_weights::Ptr{Cdouble})::Cint
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_nelements_jl(simstate)
+    element_weights_jl = unsafe_wrap(Array, element_weights, size)
+
+    return trixi_rebalance_jl(simstate, element_weights_jl)
+end
+
+trixi_rebalance_cfptr() = @cfunction(trixi_rebalance, Cint, (Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_save_state_size(simstate_handle::Cint)::Cint
+
+Return the number of `double` values required for a buffer that can hold a snapshot of the
+time integration state, see [`trixi_save_state`](@ref). The size changes if the mesh is
+changed (e.g., by AMR).
+"""
+function trixi_save_state_size end
+
+Base.@ccallable function trixi_save_state_size(simstate_handle::Cint)::Cint
+    simstate = load_simstate(simstate_handle)
+    return trixi_save_state_size_jl(simstate)
+end
+
+trixi_save_state_size_cfptr() = @cfunction(trixi_save_state_size, Cint, (Cint,))
+
+
+"""
+    trixi_save_state(simstate_handle::Cint, buffer::Ptr{Cdouble})::Cvoid
+
+Save a snapshot of the time integration state to `buffer`, which must hold at least
+[`trixi_save_state_size`](@ref) values. The snapshot comprises the solution `u`, all
+registers of the time integration method (e.g., the stages of low-storage Runge-Kutta
+methods), and the current time, time step (as set by the `StepsizeCallback`), and step
+counter. It can be used to roll back the simulation with
+[`trixi_restore_state`](@ref).
+"""
+function trixi_save_state end
+
+Base.@ccallable function trixi_save_state(simstate_handle::Cint,
+                                          buffer::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # Wrap buffer
+    size = trixi_save_state_size_jl(simstate)
+    buffer_jl = unsafe_wrap(Array, buffer, size)
+
+    trixi_save_state_jl(simstate, buffer_jl)
+
+    return nothing
+end
+
+trixi_save_state_cfptr() = @cfunction(trixi_save_state, Cvoid, (Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_restore_state(simstate_handle::Cint, buffer::Ptr{Cdouble})::Cvoid
+
+Restore the time integration state from a snapshot in `buffer` that was created by
+[`trixi_save_state`](@ref) for the same simulation. Data is copied into the existing
+arrays, no memory is allocated. Continuing the simulation afterwards yields the same
+results as continuing it right after the snapshot was taken.
+
+Effects of callbacks that were executed in between (e.g., output files) are not undone. It
+is an error to restore a snapshot after the mesh has been changed.
+"""
+function trixi_restore_state end
+
+Base.@ccallable function trixi_restore_state(simstate_handle::Cint,
+                                             buffer::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # Wrap buffer
+    size = trixi_save_state_size_jl(simstate)
+    buffer_jl = unsafe_wrap(Array, buffer, size)
+
+    trixi_restore_state_jl(simstate, buffer_jl)
+
+    return nothing
+end
+
+trixi_restore_state_cfptr() = @cfunction(trixi_restore_state, Cvoid, (Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_checkpoint_async(simstate_handle::Cint)::Cvoid
+
+Start writing a checkpoint of the current solution in the background and return
+immediately. The solution is copied to a staging buffer, such that the simulation can be
+advanced while the output is written. Output settings such as the output directory and the
+solution variables are taken from the `SaveSolutionCallback` of the libelixir, which must
+be present (use `interval=0` to disable its synchronous output). Use
+[`trixi_checkpoint_wait`](@ref) to wait for completion.
+
+Only one checkpoint per simulation can be pending; starting a new one waits for the
+previous one. For actual overlap, Julia needs to run with more than one thread (see
+`trixi_initialize_with_threads`). Otherwise, and always for parallel simulations, the
+checkpoint is written synchronously, since the collective output operations must not
+overlap with those of the time stepping.
+"""
+function trixi_checkpoint_async end
+
+Base.@ccallable function trixi_checkpoint_async(simstate_handle::Cint)::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_checkpoint_async_jl(simstate)
+
+    return nothing
+end
+
+trixi_checkpoint_async_cfptr() = @cfunction(trixi_checkpoint_async, Cvoid, (Cint,))
+
+
+"""
+    trixi_checkpoint_wait(simstate_handle::Cint)::Cvoid
+
+Wait until a checkpoint started by [`trixi_checkpoint_async`](@ref) has been written
+completely. Returns immediately if no checkpoint is pending.
+"""
+function trixi_checkpoint_wait end
+
+Base.@ccallable function trixi_checkpoint_wait(simstate_handle::Cint)::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_checkpoint_wait_jl(simstate)
+
+    return nothing
+end
+
+trixi_checkpoint_wait_cfptr() = @cfunction(trixi_checkpoint_wait, Cvoid, (Cint,))
+
+
+"""
+    trixi_write_restart(simstate_handle::Cint, filename::Cstring)::Cvoid
+
+Write a restart file with the current local solution and time integration state. The file
+consists of a small header followed by the raw contents of the solution array in
+Trixi.jl's native memory layout and byte order. In parallel simulations, each MPI rank
+writes its own file, with the zero-padded rank appended to `filename` (e.g., `_000001`).
+
+Use [`trixi_initialize_simulation_from_restart`](@ref) to continue the simulation.
+"""
+function trixi_write_restart end
+
+Base.@ccallable function trixi_write_restart(simstate_handle::Cint,
+                                             filename::Cstring)::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_write_restart_jl(simstate, unsafe_string(filename))
+
+    return nothing
+end
+
+trixi_write_restart_cfptr() = @cfunction(trixi_write_restart, Cvoid, (Cint, Cstring))
+
+
+"""
+    trixi_initialize_simulation_from_restart(libelixir::Cstring,
+                                             restart_filename::Cstring)::Cint
+
+Initialize a new simulation from `libelixir` like
+[`trixi_initialize_simulation`](@ref), then continue from the state stored in a restart
+file written by [`trixi_write_restart`](@ref). The restart file is mapped into memory and
+copied into the solution in a single pass. Time, step counter, and time step are restored,
+and callbacks are reinitialized at the restart time.
+
+The libelixir must create the same mesh with the same partitioning (i.e., the same number
+of MPI ranks) as the simulation that wrote the restart file, which is checked against the
+file header. Thus restarting is not possible for simulations with a changed mesh (e.g.,
+due to AMR).
+"""
+function trixi_initialize_simulation_from_restart end
+
+Base.@ccallable function trixi_initialize_simulation_from_restart(libelixir::Cstring,
+        restart_filename::Cstring)::Cint
+    simstate = trixi_initialize_simulation_from_restart_jl(unsafe_string(libelixir),
+                                                           unsafe_string(restart_filename))
+    simstate_handle = store_simstate(simstate)
+
+    return simstate_handle
+end
+
+trixi_initialize_simulation_from_restart_cfptr() =
+    @cfunction(trixi_initialize_simulation_from_restart, Cint, (Cstring, Cstring))
+
+
 """
     trixi_finalize_simulation(simstate_handle::Cint)::Cvoid
 
-Finalize a simulation and attempt to free the underlying memory.
+Finalize a simulation and attempt to free the underlying memory. The handle becomes
+invalid, and subsequently created simulations will receive different handles.
 """
 function trixi_finalize_simulation end
 
@@ -312,6 +591,26 @@ end
 trixi_nelementsglobal_cfptr() = @cfunction(trixi_nelementsglobal, Cint, (Cint,))
 
 
+"""
+    trixi_element_global_offset(simstate_handle::Cint)::Cint
+
+Return global index offset of the local elements.
+
+The first local element has the global index `offset + 1` (in 1-based counting). This is a
+collective operation in parallel simulations, but communication only takes place on the
+first call after each mesh change.
+"""
+function trixi_element_global_offset end
+
+Base.@ccallable function trixi_element_global_offset(simstate_handle::Cint)::Cint
+    simstate = load_simstate(simstate_handle)
+    return trixi_element_global_offset_jl(simstate)
+end
+
+trixi_element_global_offset_cfptr() =
+    @cfunction(trixi_element_global_offset, Cint, (Cint,))
+
+
 """
     trixi_ndofs(simstate_handle::Cint)::Cint
 
@@ -432,6 +731,32 @@ trixi_load_node_weights_cfptr() =
     @cfunction(trixi_load_node_weights, Cvoid, (Cint, Ptr{Cdouble}))
 
 
+"""
+    trixi_load_node_coordinates(simstate_handle::Cint, data::Ptr{Cdouble})::Cvoid
+
+Get physical coordinates of all quadrature nodes.
+
+Coordinate `d` of degree of freedom `i` is stored at `data[d + ndims * (i - 1)]`. The given
+array has to be of correct size (ndims * ndofs) and memory has to be allocated beforehand.
+"""
+function trixi_load_node_coordinates end
+
+Base.@ccallable function trixi_load_node_coordinates(simstate_handle::Cint,
+                                                     data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_ndims_jl(simstate) * trixi_ndofs_jl(simstate)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_node_coordinates_jl(simstate, data_jl)
+    return nothing
+end
+
+trixi_load_node_coordinates_cfptr() =
+    @cfunction(trixi_load_node_coordinates, Cvoid, (Cint, Ptr{Cdouble}))
+
+
 """
     trixi_load_conservative_var(simstate_handle::Cint, variable_id::Cint,
                                 data::Ptr{Cdouble})::Cvoid
@@ -457,143 +782,796 @@ trixi_load_conservative_var_cfptr() =
 
 
 """
-    trixi_load_primitive_var(simstate_handle::Cint, variable_id::Cint,
-                             data::Ptr{Cdouble})::Cvoid
+    trixi_load_conservative_var_float(simstate_handle::Cint, variable_id::Cint,
+                                      data::Ptr{Cfloat})::Cvoid
 
-Load primitive variable.
-
-The values for the primitive variable at position `variable_id` at every degree of freedom
-are stored in the given array `data`.
+Load conservative variable in single precision.
 
-The given array has to be of correct size (ndofs) and memory has to be allocated beforehand.
+Same as [`trixi_load_conservative_var`](@ref), but the values are converted to `Cfloat`
+while copying.
 """
-function trixi_load_primitive_var end
+function trixi_load_conservative_var_float end
 
-Base.@ccallable function trixi_load_primitive_var(simstate_handle::Cint, variable_id::Cint,
-                                                  data::Ptr{Cdouble})::Cvoid
+Base.@ccallable function trixi_load_conservative_var_float(simstate_handle::Cint,
+                                                           variable_id::Cint,
+                                                           data::Ptr{Cfloat})::Cvoid
     simstate = load_simstate(simstate_handle)
 
     # convert C to Julia array
     size = trixi_ndofs_jl(simstate)
     data_jl = unsafe_wrap(Array, data, size)
 
-    trixi_load_primitive_var_jl(simstate, variable_id, data_jl)
+    trixi_load_conservative_var_jl(simstate, variable_id, data_jl)
     return nothing
 end
 
-trixi_load_primitive_var_cfptr() =
-    @cfunction(trixi_load_primitive_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
+trixi_load_conservative_var_float_cfptr() =
+    @cfunction(trixi_load_conservative_var_float, Cvoid, (Cint, Cint, Ptr{Cfloat}))
 
 
 """
-    trixi_store_conservative_var(simstate_handle::Cint, variable_id::Cint,
-                                 data::Ptr{Cdouble})::Cvoid
+    trixi_load_conservative_vars(simstate_handle::Cint, nvariables::Cint,
+                                 variable_ids::Ptr{Cint},
+                                 data::Ptr{Ptr{Cdouble}})::Cvoid
 
-Store conservative variable.
+Load multiple conservative variables in a single pass over the internal data.
+
+The values for the conservative variable at position `variable_ids[i]` at every degree of
+freedom are stored in the array `data[i]`, for `i` in `1:nvariables`.
+
+Each of the given arrays has to be of correct size (ndofs) and memory has to be allocated
+beforehand.
 """
-function trixi_store_conservative_var end
+function trixi_load_conservative_vars end
 
-Base.@ccallable function trixi_store_conservative_var(simstate_handle::Cint,
-                                                      variable_id::Cint,
-                                                      data::Ptr{Cdouble})::Cvoid
+Base.@ccallable function trixi_load_conservative_vars(simstate_handle::Cint,
+                                                      nvariables::Cint,
+                                                      variable_ids::Ptr{Cint},
+                                                      data::Ptr{Ptr{Cdouble}})::Cvoid
     simstate = load_simstate(simstate_handle)
 
-    # convert C to Julia array
+    # convert C to Julia arrays
     size = trixi_ndofs_jl(simstate)
-    data_jl = unsafe_wrap(Array, data, size)
+    variable_ids_jl = unsafe_wrap(Array, variable_ids, nvariables)
+    data_jl = [unsafe_wrap(Array, ptr, size) for ptr in unsafe_wrap(Array, data, nvariables)]
 
-    trixi_store_conservative_var_jl(simstate, variable_id, data_jl)
+    trixi_load_conservative_vars_jl(simstate, variable_ids_jl, data_jl)
+    return nothing
 end
 
-trixi_store_conservative_var_cfptr() =
-    @cfunction(trixi_store_conservative_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
+trixi_load_conservative_vars_cfptr() =
+    @cfunction(trixi_load_conservative_vars, Cvoid,
+               (Cint, Cint, Ptr{Cint}, Ptr{Ptr{Cdouble}}))
 
 
 """
-    trixi_register_data(data::Ptr{Cdouble}, size::Cint, index::Cint,
-                        simstate_handle::Cint)::Cvoid
-
-Store data vector in current simulation's registry.
+    trixi_load_conservative_vars_float(simstate_handle::Cint, nvariables::Cint,
+                                       variable_ids::Ptr{Cint},
+                                       data::Ptr{Ptr{Cfloat}})::Cvoid
 
-A reference to the passed data array `data` will be stored in the registry of the simulation
-given by `simstate_handle` at given `index`. The registry object has to be created in
-`init_simstate()` of the running libelixir and can be used throughout the simulation.
+Load multiple conservative variables in single precision.
 
-The registry object has to exist, has to be of type `LibTrixiDataRegistry`, and has to hold
-enough data references such that access at `index` is valid.
-Memory storage remains on the user side. It must not be deallocated as long as it might be
-accessed via the registry. The size of `data` has to match `size`.
+Same as [`trixi_load_conservative_vars`](@ref), but the values are converted to `Cfloat`
+while copying.
 """
-function trixi_register_data end
+function trixi_load_conservative_vars_float end
 
-Base.@ccallable function trixi_register_data(simstate_handle::Cint, index::Cint,
-                                             size::Cint, data::Ptr{Cdouble})::Cvoid
+Base.@ccallable function trixi_load_conservative_vars_float(simstate_handle::Cint,
+                                                            nvariables::Cint,
+                                                            variable_ids::Ptr{Cint},
+                                                            data::Ptr{Ptr{Cfloat}})::Cvoid
     simstate = load_simstate(simstate_handle)
 
-    # convert C to Julia array
-    data_jl = unsafe_wrap(Array, data, size)
+    # convert C to Julia arrays
+    size = trixi_ndofs_jl(simstate)
+    variable_ids_jl = unsafe_wrap(Array, variable_ids, nvariables)
+    data_jl = [unsafe_wrap(Array, ptr, size) for ptr in unsafe_wrap(Array, data, nvariables)]
 
-    trixi_register_data_jl(simstate, index, data_jl)
+    trixi_load_conservative_vars_jl(simstate, variable_ids_jl, data_jl)
     return nothing
 end
 
-trixi_register_data_cfptr() =
-    @cfunction(trixi_register_data, Cvoid, (Cint, Cint, Cint, Ptr{Cdouble},))
+trixi_load_conservative_vars_float_cfptr() =
+    @cfunction(trixi_load_conservative_vars_float, Cvoid,
+               (Cint, Cint, Ptr{Cint}, Ptr{Ptr{Cfloat}}))
 
 
 """
-    trixi_get_simulation_time(simstate_handle::Cint)::Cdouble
+    trixi_load_primitive_var(simstate_handle::Cint, variable_id::Cint,
+                             data::Ptr{Cdouble})::Cvoid
 
-Return current physical time.
+Load primitive variable.
+
+The values for the primitive variable at position `variable_id` at every degree of freedom
+are stored in the given array `data`.
+
+The given array has to be of correct size (ndofs) and memory has to be allocated beforehand.
 """
-function trixi_get_simulation_time end
+function trixi_load_primitive_var end
 
-Base.@ccallable function trixi_get_simulation_time(simstate_handle::Cint)::Cdouble
+Base.@ccallable function trixi_load_primitive_var(simstate_handle::Cint, variable_id::Cint,
+                                                  data::Ptr{Cdouble})::Cvoid
     simstate = load_simstate(simstate_handle)
-    return trixi_get_simulation_time_jl(simstate)
+
+    # convert C to Julia array
+    size = trixi_ndofs_jl(simstate)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_primitive_var_jl(simstate, variable_id, data_jl)
+    return nothing
 end
 
-trixi_get_simulation_time_cfptr() = @cfunction(trixi_get_simulation_time, Cdouble, (Cint,))
+trixi_load_primitive_var_cfptr() =
+    @cfunction(trixi_load_primitive_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
 
 
 """
-    trixi_load_element_averaged_primitive_var(simstate_handle::Cint, variable_id::Cint,
-                                              data::Ptr{Cdouble})::Cvoid
+    trixi_load_primitive_var_float(simstate_handle::Cint, variable_id::Cint,
+                                   data::Ptr{Cfloat})::Cvoid
 
-Load element averages for primitive variable.
-
-Element averaged values for the primitive variable at position `variable_id` for each
-element are stored in the given array `data`.
+Load primitive variable in single precision.
 
-The given array has to be of correct size (nelements) and memory has to be allocated
-beforehand.
+Same as [`trixi_load_primitive_var`](@ref), but the values are converted to `Cfloat` while
+copying. The conversion to primitive variables is still performed in double precision.
 """
-function trixi_load_element_averaged_primitive_var end
+function trixi_load_primitive_var_float end
 
-Base.@ccallable function trixi_load_element_averaged_primitive_var(simstate_handle::Cint,
-    variable_id::Cint, data::Ptr{Cdouble})::Cvoid
+Base.@ccallable function trixi_load_primitive_var_float(simstate_handle::Cint,
+                                                        variable_id::Cint,
+                                                        data::Ptr{Cfloat})::Cvoid
     simstate = load_simstate(simstate_handle)
 
     # convert C to Julia array
-    size = trixi_nelements_jl(simstate)
+    size = trixi_ndofs_jl(simstate)
     data_jl = unsafe_wrap(Array, data, size)
 
-    trixi_load_element_averaged_primitive_var_jl(simstate, variable_id, data_jl)
+    trixi_load_primitive_var_jl(simstate, variable_id, data_jl)
     return nothing
 end
 
-trixi_load_element_averaged_primitive_var_cfptr() =
-    @cfunction(trixi_load_element_averaged_primitive_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
+trixi_load_primitive_var_float_cfptr() =
+    @cfunction(trixi_load_primitive_var_float, Cvoid, (Cint, Cint, Ptr{Cfloat}))
 
 
 """
-    trixi_get_conservative_vars_pointer(simstate_handle::Cint)::Ptr{Cdouble}
+    trixi_load_primitive_vars(simstate_handle::Cint, nvariables::Cint,
+                              variable_ids::Ptr{Cint}, data::Ptr{Ptr{Cdouble}})::Cvoid
 
-Return pointer to internal data vector.
-"""
-function trixi_get_conservative_vars_pointer end
+Load multiple primitive variables.
 
-Base.@ccallable function trixi_get_conservative_vars_pointer(simstate_handle::Cint)::Ptr{Cdouble}
+The values for the primitive variable at position `variable_ids[i]` at every degree of
+freedom are stored in the array `data[i]`, for `i` in `1:nvariables`. The conversion to
+primitive variables is performed only once per degree of freedom.
+
+Each of the given arrays has to be of correct size (ndofs) and memory has to be allocated
+beforehand.
+"""
+function trixi_load_primitive_vars end
+
+Base.@ccallable function trixi_load_primitive_vars(simstate_handle::Cint, nvariables::Cint,
+                                                   variable_ids::Ptr{Cint},
+                                                   data::Ptr{Ptr{Cdouble}})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    size = trixi_ndofs_jl(simstate)
+    variable_ids_jl = unsafe_wrap(Array, variable_ids, nvariables)
+    data_jl = [unsafe_wrap(Array, ptr, size) for ptr in unsafe_wrap(Array, data, nvariables)]
+
+    trixi_load_primitive_vars_jl(simstate, variable_ids_jl, data_jl)
+    return nothing
+end
+
+trixi_load_primitive_vars_cfptr() =
+    @cfunction(trixi_load_primitive_vars, Cvoid, (Cint, Cint, Ptr{Cint}, Ptr{Ptr{Cdouble}}))
+
+
+"""
+    trixi_load_primitive_vars_float(simstate_handle::Cint, nvariables::Cint,
+                                    variable_ids::Ptr{Cint},
+                                    data::Ptr{Ptr{Cfloat}})::Cvoid
+
+Load multiple primitive variables in single precision.
+
+Same as [`trixi_load_primitive_vars`](@ref), but the values are converted to `Cfloat` while
+copying. The conversion to primitive variables is still performed in double precision.
+"""
+function trixi_load_primitive_vars_float end
+
+Base.@ccallable function trixi_load_primitive_vars_float(simstate_handle::Cint,
+                                                         nvariables::Cint,
+                                                         variable_ids::Ptr{Cint},
+                                                         data::Ptr{Ptr{Cfloat}})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    size = trixi_ndofs_jl(simstate)
+    variable_ids_jl = unsafe_wrap(Array, variable_ids, nvariables)
+    data_jl = [unsafe_wrap(Array, ptr, size) for ptr in unsafe_wrap(Array, data, nvariables)]
+
+    trixi_load_primitive_vars_jl(simstate, variable_ids_jl, data_jl)
+    return nothing
+end
+
+trixi_load_primitive_vars_float_cfptr() =
+    @cfunction(trixi_load_primitive_vars_float, Cvoid,
+               (Cint, Cint, Ptr{Cint}, Ptr{Ptr{Cfloat}}))
+
+
+"""
+    trixi_store_conservative_var(simstate_handle::Cint, variable_id::Cint,
+                                 data::Ptr{Cdouble})::Cvoid
+
+Store conservative variable.
+"""
+function trixi_store_conservative_var end
+
+Base.@ccallable function trixi_store_conservative_var(simstate_handle::Cint,
+                                                      variable_id::Cint,
+                                                      data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_ndofs_jl(simstate)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_store_conservative_var_jl(simstate, variable_id, data_jl)
+end
+
+trixi_store_conservative_var_cfptr() =
+    @cfunction(trixi_store_conservative_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_load_conservative_var_elements(simstate_handle::Cint, variable_id::Cint,
+                                         nelements::Cint, elements::Ptr{Cint},
+                                         data::Ptr{Cdouble})::Cvoid
+
+Load conservative variable on a subset of elements.
+
+The values for the conservative variable at position `variable_id` at every degree of
+freedom of the (one-based) local elements `elements[1:nelements]` are stored in the given
+array `data`, ordered by their position in `elements`.
+
+The given array has to be of size `nelements * ndofselement` and memory has to be allocated
+beforehand.
+"""
+function trixi_load_conservative_var_elements end
+
+Base.@ccallable function trixi_load_conservative_var_elements(simstate_handle::Cint,
+                                                              variable_id::Cint,
+                                                              nelements::Cint,
+                                                              elements::Ptr{Cint},
+                                                              data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    elements_jl = unsafe_wrap(Array, elements, nelements)
+    data_jl = unsafe_wrap(Array, data, nelements * trixi_ndofselement_jl(simstate))
+
+    trixi_load_conservative_var_elements_jl(simstate, variable_id, elements_jl, data_jl)
+    return nothing
+end
+
+trixi_load_conservative_var_elements_cfptr() =
+    @cfunction(trixi_load_conservative_var_elements, Cvoid,
+               (Cint, Cint, Cint, Ptr{Cint}, Ptr{Cdouble}))
+
+
+"""
+    trixi_load_primitive_var_elements(simstate_handle::Cint, variable_id::Cint,
+                                      nelements::Cint, elements::Ptr{Cint},
+                                      data::Ptr{Cdouble})::Cvoid
+
+Load primitive variable on a subset of elements.
+
+The values for the primitive variable at position `variable_id` at every degree of freedom
+of the (one-based) local elements `elements[1:nelements]` are stored in the given array
+`data`, ordered by their position in `elements`.
+
+The given array has to be of size `nelements * ndofselement` and memory has to be allocated
+beforehand.
+"""
+function trixi_load_primitive_var_elements end
+
+Base.@ccallable function trixi_load_primitive_var_elements(simstate_handle::Cint,
+                                                           variable_id::Cint,
+                                                           nelements::Cint,
+                                                           elements::Ptr{Cint},
+                                                           data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    elements_jl = unsafe_wrap(Array, elements, nelements)
+    data_jl = unsafe_wrap(Array, data, nelements * trixi_ndofselement_jl(simstate))
+
+    trixi_load_primitive_var_elements_jl(simstate, variable_id, elements_jl, data_jl)
+    return nothing
+end
+
+trixi_load_primitive_var_elements_cfptr() =
+    @cfunction(trixi_load_primitive_var_elements, Cvoid,
+               (Cint, Cint, Cint, Ptr{Cint}, Ptr{Cdouble}))
+
+
+"""
+    trixi_store_conservative_var_elements(simstate_handle::Cint, variable_id::Cint,
+                                          nelements::Cint, elements::Ptr{Cint},
+                                          data::Ptr{Cdouble})::Cvoid
+
+Store conservative variable on a subset of elements.
+
+The values for the conservative variable at position `variable_id` at every degree of
+freedom of the (one-based) local elements `elements[1:nelements]` are read from the given
+array `data`, ordered by their position in `elements`. All other elements are not modified.
+"""
+function trixi_store_conservative_var_elements end
+
+Base.@ccallable function trixi_store_conservative_var_elements(simstate_handle::Cint,
+                                                               variable_id::Cint,
+                                                               nelements::Cint,
+                                                               elements::Ptr{Cint},
+                                                               data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    elements_jl = unsafe_wrap(Array, elements, nelements)
+    data_jl = unsafe_wrap(Array, data, nelements * trixi_ndofselement_jl(simstate))
+
+    trixi_store_conservative_var_elements_jl(simstate, variable_id, elements_jl, data_jl)
+    return nothing
+end
+
+trixi_store_conservative_var_elements_cfptr() =
+    @cfunction(trixi_store_conservative_var_elements, Cvoid,
+               (Cint, Cint, Cint, Ptr{Cint}, Ptr{Cdouble}))
+
+
+"""
+    trixi_nboundary_faces(simstate_handle::Cint, name::Cstring)::Cint
+
+Return number of local faces on the boundary with given `name`.
+
+Boundary data is stored for all nodes of these faces, i.e., for
+`nnodes^(ndims-1) * nboundary_faces` nodes. Only available for `P4estMesh` and
+`T8codeMesh`.
+"""
+function trixi_nboundary_faces end
+
+Base.@ccallable function trixi_nboundary_faces(simstate_handle::Cint, name::Cstring)::Cint
+    simstate = load_simstate(simstate_handle)
+    return trixi_nboundary_faces_jl(simstate, unsafe_string(name))
+end
+
+trixi_nboundary_faces_cfptr() =
+    @cfunction(trixi_nboundary_faces, Cint, (Cint, Cstring))
+
+
+"""
+    trixi_load_boundary_face_elements(simstate_handle::Cint, name::Cstring,
+                                      elements::Ptr{Cint})::Cvoid
+
+Load (1-based) element index of each local face on the boundary with given `name`.
+"""
+function trixi_load_boundary_face_elements end
+
+Base.@ccallable function trixi_load_boundary_face_elements(simstate_handle::Cint,
+                                                           name::Cstring,
+                                                           elements::Ptr{Cint})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    name_jl = unsafe_string(name)
+
+    # convert C to Julia array
+    size = trixi_nboundary_faces_jl(simstate, name_jl)
+    elements_jl = unsafe_wrap(Array, elements, size)
+
+    trixi_load_boundary_face_elements_jl(simstate, name_jl, elements_jl)
+    return nothing
+end
+
+trixi_load_boundary_face_elements_cfptr() =
+    @cfunction(trixi_load_boundary_face_elements, Cvoid, (Cint, Cstring, Ptr{Cint}))
+
+
+"""
+    trixi_load_boundary_node_coordinates(simstate_handle::Cint, name::Cstring,
+                                         data::Ptr{Cdouble})::Cvoid
+
+Load physical coordinates of the nodes on the boundary with given `name`.
+
+The coordinates of each node are stored contiguously, i.e., `data` needs to hold
+`ndims * nnodes^(ndims-1) * nboundary_faces` values.
+"""
+function trixi_load_boundary_node_coordinates end
+
+Base.@ccallable function trixi_load_boundary_node_coordinates(simstate_handle::Cint,
+                                                              name::Cstring,
+                                                              data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    name_jl = unsafe_string(name)
+
+    # convert C to Julia array
+    size = trixi_ndims_jl(simstate) * nboundary_nodes(simstate, name_jl)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_boundary_node_coordinates_jl(simstate, name_jl, data_jl)
+    return nothing
+end
+
+trixi_load_boundary_node_coordinates_cfptr() =
+    @cfunction(trixi_load_boundary_node_coordinates, Cvoid, (Cint, Cstring, Ptr{Cdouble}))
+
+
+"""
+    trixi_load_boundary_conservative_var(simstate_handle::Cint, name::Cstring,
+                                         variable_id::Cint, data::Ptr{Cdouble})::Cvoid
+
+Load conservative variable `variable_id` at the nodes on the boundary with given `name`.
+
+Only the nodes on the boundary are accessed. `data` needs to hold
+`nnodes^(ndims-1) * nboundary_faces` values.
+"""
+function trixi_load_boundary_conservative_var end
+
+Base.@ccallable function trixi_load_boundary_conservative_var(simstate_handle::Cint,
+                                                              name::Cstring,
+                                                              variable_id::Cint,
+                                                              data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    name_jl = unsafe_string(name)
+
+    # convert C to Julia array
+    size = nboundary_nodes(simstate, name_jl)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_boundary_conservative_var_jl(simstate, name_jl, variable_id, data_jl)
+    return nothing
+end
+
+trixi_load_boundary_conservative_var_cfptr() =
+    @cfunction(trixi_load_boundary_conservative_var, Cvoid,
+               (Cint, Cstring, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_load_boundary_primitive_var(simstate_handle::Cint, name::Cstring,
+                                      variable_id::Cint, data::Ptr{Cdouble})::Cvoid
+
+Load primitive variable `variable_id` at the nodes on the boundary with given `name`.
+
+Only the nodes on the boundary are accessed. `data` needs to hold
+`nnodes^(ndims-1) * nboundary_faces` values.
+"""
+function trixi_load_boundary_primitive_var end
+
+Base.@ccallable function trixi_load_boundary_primitive_var(simstate_handle::Cint,
+                                                           name::Cstring,
+                                                           variable_id::Cint,
+                                                           data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    name_jl = unsafe_string(name)
+
+    # convert C to Julia array
+    size = nboundary_nodes(simstate, name_jl)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_boundary_primitive_var_jl(simstate, name_jl, variable_id, data_jl)
+    return nothing
+end
+
+trixi_load_boundary_primitive_var_cfptr() =
+    @cfunction(trixi_load_boundary_primitive_var, Cvoid,
+               (Cint, Cstring, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_register_data(data::Ptr{Cdouble}, size::Cint, index::Cint,
+                        simstate_handle::Cint)::Cvoid
+
+Store data vector in current simulation's registry.
+
+A reference to the passed data array `data` will be stored in the registry of the simulation
+given by `simstate_handle` at given `index`. The registry object has to be created in
+`init_simstate()` of the running libelixir and can be used throughout the simulation.
+
+The registry object has to exist, has to be of type `LibTrixiDataRegistry`, and has to hold
+enough data references such that access at `index` is valid.
+Memory storage remains on the user side. It must not be deallocated as long as it might be
+accessed via the registry. The size of `data` has to match `size`.
+"""
+function trixi_register_data end
+
+Base.@ccallable function trixi_register_data(simstate_handle::Cint, index::Cint,
+                                             size::Cint, data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_register_data_jl(simstate, index, data_jl)
+    return nothing
+end
+
+trixi_register_data_cfptr() =
+    @cfunction(trixi_register_data, Cvoid, (Cint, Cint, Cint, Ptr{Cdouble},))
+
+
+"""
+    trixi_register_boundary_data(simstate_handle::Cint, name::Cstring,
+                                 data::Ptr{Cdouble})::Cvoid
+
+Register outer boundary states for the boundary with given `name`.
+
+`data` holds all conservative variables at each node on the boundary, i.e.,
+`nvariables * nnodes^(ndims-1) * nboundary_faces` values with the variables of each node
+stored contiguously. The boundary of the simulation given by `simstate_handle` has to use a
+[`LibTrixiBoundaryCondition`](@ref) in `init_simstate()` of the running libelixir.
+
+Memory storage remains on the user side and is read whenever boundary fluxes are computed,
+such that it can be updated between time steps without registering it again. It must not be
+deallocated as long as it might be accessed. After mesh changes, `data` has to be registered
+again.
+"""
+function trixi_register_boundary_data end
+
+Base.@ccallable function trixi_register_boundary_data(simstate_handle::Cint, name::Cstring,
+                                                      data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    name_jl = unsafe_string(name)
+
+    # convert C to Julia array
+    size = trixi_nvariables_jl(simstate) * nboundary_nodes(simstate, name_jl)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_register_boundary_data_jl(simstate, name_jl, data_jl)
+    return nothing
+end
+
+trixi_register_boundary_data_cfptr() =
+    @cfunction(trixi_register_boundary_data, Cvoid, (Cint, Cstring, Ptr{Cdouble}))
+
+
+"""
+    trixi_registry_alloc(simstate_handle::Cint, index::Cint,
+                         ncomponents::Cint)::Ptr{Cdouble}
+
+Allocate data vector in current simulation's registry and return pointer to it.
+
+In contrast to [`trixi_register_data`](@ref), the data vector at `index` is owned by
+libtrixi. It holds `ncomponents` values at each node of each element, using the same layout
+as the conservative variables (see [`trixi_get_state_layout`](@ref)), and is initialized to
+zero. Whenever the mesh changes (e.g., due to AMR), the values are transferred to the new
+mesh by copying unchanged elements and projecting refined or coarsened ones with the same
+operators as the solution. In parallel simulations, values are moved along with their
+elements when the mesh is repartitioned.
+
+The registry object has to exist and has to hold enough data references such that access at
+`index` is valid. The returned pointer becomes invalid when the mesh changes, use
+[`trixi_registry_get_pointer`](@ref) to obtain the current one.
+"""
+function trixi_registry_alloc end
+
+Base.@ccallable function trixi_registry_alloc(simstate_handle::Cint, index::Cint,
+                                              ncomponents::Cint)::Ptr{Cdouble}
+    simstate = load_simstate(simstate_handle)
+    return trixi_registry_alloc_jl(simstate, index, ncomponents)
+end
+
+trixi_registry_alloc_cfptr() =
+    @cfunction(trixi_registry_alloc, Ptr{Cdouble}, (Cint, Cint, Cint))
+
+
+"""
+    trixi_registry_get_pointer(simstate_handle::Cint, index::Cint)::Ptr{Cdouble}
+
+Return pointer to data vector allocated by [`trixi_registry_alloc`](@ref) at `index`.
+"""
+function trixi_registry_get_pointer end
+
+Base.@ccallable function trixi_registry_get_pointer(simstate_handle::Cint,
+                                                    index::Cint)::Ptr{Cdouble}
+    simstate = load_simstate(simstate_handle)
+    return trixi_registry_get_pointer_jl(simstate, index)
+end
+
+trixi_registry_get_pointer_cfptr() =
+    @cfunction(trixi_registry_get_pointer, Ptr{Cdouble}, (Cint, Cint))
+
+
+"""
+    trixi_register_source_terms(simstate_handle::Cint, source_terms::Ptr{Cvoid},
+                                userdata::Ptr{Cvoid})::Cvoid
+
+Register C function to compute source terms.
+
+The function `source_terms` is called during every evaluation of the right-hand side with
+signature
+```c
+void source_terms(double time, const double * u, double * du,
+                  const double * node_coordinates, int nelements, void * userdata)
+```
+and has to add its contribution to `du`.
+
+The semidiscretization of the simulation given by `simstate_handle` has to be created with
+a [`LibTrixiSourceTerms`](@ref) object as source terms in `init_simstate()` of the running
+libelixir. Passing a null pointer as `source_terms` deactivates the source terms.
+"""
+function trixi_register_source_terms end
+
+Base.@ccallable function trixi_register_source_terms(simstate_handle::Cint,
+                                                     source_terms::Ptr{Cvoid},
+                                                     userdata::Ptr{Cvoid})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_register_source_terms_jl(simstate, source_terms, userdata)
+    return nothing
+end
+
+trixi_register_source_terms_cfptr() =
+    @cfunction(trixi_register_source_terms, Cvoid, (Cint, Ptr{Cvoid}, Ptr{Cvoid}))
+
+
+"""
+    trixi_set_refinement_indicator(simstate_handle::Cint, indicator::Ptr{Cdouble})::Cvoid
+
+Set refinement indicator used for the next mesh adaptation.
+
+`indicator` has to hold one value per local element and is used by the AMR controller in
+place of an indicator computed by Trixi.jl. The AMR controller of the simulation given by
+`simstate_handle` has to be created with a [`LibTrixiRefinementIndicator`](@ref) object as
+indicator in `init_simstate()` of the running libelixir.
+
+The values are not copied. Memory storage remains on the user side and must not be
+deallocated as long as the mesh might be adapted. After each mesh change, the indicator
+has to be set again with the new number of elements.
+"""
+function trixi_set_refinement_indicator end
+
+Base.@ccallable function trixi_set_refinement_indicator(simstate_handle::Cint,
+                                                        indicator::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_nelements_jl(simstate)
+    indicator_jl = unsafe_wrap(Array, indicator, size)
+
+    trixi_set_refinement_indicator_jl(simstate, indicator_jl)
+    return nothing
+end
+
+trixi_set_refinement_indicator_cfptr() =
+    @cfunction(trixi_set_refinement_indicator, Cvoid, (Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_mesh_epoch(simstate_handle::Cint)::Cint
+
+Return number of mesh changes since the simulation was initialized.
+
+The mesh epoch is incremented whenever the mesh was changed during a time step, e.g., by
+adaptive mesh refinement or repartitioning. Sizes such as `ndofs` and all data depending on
+the mesh (e.g., node coordinates) only need to be queried again if the epoch has changed.
+"""
+function trixi_mesh_epoch end
+
+Base.@ccallable function trixi_mesh_epoch(simstate_handle::Cint)::Cint
+    simstate = load_simstate(simstate_handle)
+    return trixi_mesh_epoch_jl(simstate)
+end
+
+trixi_mesh_epoch_cfptr() = @cfunction(trixi_mesh_epoch, Cint, (Cint,))
+
+
+"""
+    trixi_register_mesh_change_callback(simstate_handle::Cint, callback::Ptr{Cvoid},
+                                        userdata::Ptr{Cvoid})::Cvoid
+
+Register C function to be notified about mesh changes.
+
+The function `callback` is called at the end of every time step in which the mesh was
+changed, with signature
+```c
+void callback(int epoch, int nelements_old, int nelements_new, void * userdata)
+```
+where `epoch` is the new mesh epoch (see [`trixi_mesh_epoch`](@ref)) and `nelements_old`
+and `nelements_new` are the local numbers of elements before and after the change. Passing
+a null pointer as `callback` deactivates the notification.
+"""
+function trixi_register_mesh_change_callback end
+
+Base.@ccallable function trixi_register_mesh_change_callback(simstate_handle::Cint,
+                                                             callback::Ptr{Cvoid},
+                                                             userdata::Ptr{Cvoid})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_register_mesh_change_callback_jl(simstate, callback, userdata)
+    return nothing
+end
+
+trixi_register_mesh_change_callback_cfptr() =
+    @cfunction(trixi_register_mesh_change_callback, Cvoid, (Cint, Ptr{Cvoid}, Ptr{Cvoid}))
+
+
+"""
+    trixi_get_simulation_time(simstate_handle::Cint)::Cdouble
+
+Return current physical time.
+"""
+function trixi_get_simulation_time end
+
+Base.@ccallable function trixi_get_simulation_time(simstate_handle::Cint)::Cdouble
+    simstate = load_simstate(simstate_handle)
+    return trixi_get_simulation_time_jl(simstate)
+end
+
+trixi_get_simulation_time_cfptr() = @cfunction(trixi_get_simulation_time, Cdouble, (Cint,))
+
+
+"""
+    trixi_load_element_averaged_primitive_var(simstate_handle::Cint, variable_id::Cint,
+                                              data::Ptr{Cdouble})::Cvoid
+
+Load element averages for primitive variable.
+
+Element averaged values for the primitive variable at position `variable_id` for each
+element are stored in the given array `data`.
+
+The given array has to be of correct size (nelements) and memory has to be allocated
+beforehand.
+"""
+function trixi_load_element_averaged_primitive_var end
+
+Base.@ccallable function trixi_load_element_averaged_primitive_var(simstate_handle::Cint,
+    variable_id::Cint, data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_nelements_jl(simstate)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_element_averaged_primitive_var_jl(simstate, variable_id, data_jl)
+    return nothing
+end
+
+trixi_load_element_averaged_primitive_var_cfptr() =
+    @cfunction(trixi_load_element_averaged_primitive_var, Cvoid, (Cint, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_load_element_averaged_primitive_var_float(simstate_handle::Cint,
+                                                    variable_id::Cint,
+                                                    data::Ptr{Cfloat})::Cvoid
+
+Load element averages for primitive variable in single precision.
+
+Same as [`trixi_load_element_averaged_primitive_var`](@ref), but the averages are computed
+in double precision and converted to `Cfloat` while copying.
+"""
+function trixi_load_element_averaged_primitive_var_float end
+
+Base.@ccallable function trixi_load_element_averaged_primitive_var_float(
+    simstate_handle::Cint, variable_id::Cint, data::Ptr{Cfloat})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    size = trixi_nelements_jl(simstate)
+    data_jl = unsafe_wrap(Array, data, size)
+
+    trixi_load_element_averaged_primitive_var_jl(simstate, variable_id, data_jl)
+    return nothing
+end
+
+trixi_load_element_averaged_primitive_var_float_cfptr() =
+    @cfunction(trixi_load_element_averaged_primitive_var_float, Cvoid,
+               (Cint, Cint, Ptr{Cfloat}))
+
+
+"""
+    trixi_get_conservative_vars_pointer(simstate_handle::Cint)::Ptr{Cdouble}
+
+Return pointer to internal data vector.
+"""
+function trixi_get_conservative_vars_pointer end
+
+Base.@ccallable function trixi_get_conservative_vars_pointer(simstate_handle::Cint)::Ptr{Cdouble}
     simstate = load_simstate(simstate_handle)
     return trixi_get_conservative_vars_pointer_jl(simstate)
 end
@@ -602,6 +1580,195 @@ trixi_get_conservative_vars_pointer_cfptr() =
     @cfunction(trixi_get_conservative_vars_pointer, Ptr{Cdouble}, (Cint,))
 
 
+"""
+    trixi_get_node_coordinates_pointer(simstate_handle::Cint)::Ptr{Cdouble}
+
+Return pointer to internal array of physical node coordinates.
+"""
+function trixi_get_node_coordinates_pointer end
+
+Base.@ccallable function trixi_get_node_coordinates_pointer(simstate_handle::Cint)::Ptr{Cdouble}
+    simstate = load_simstate(simstate_handle)
+    return trixi_get_node_coordinates_pointer_jl(simstate)
+end
+
+trixi_get_node_coordinates_pointer_cfptr() =
+    @cfunction(trixi_get_node_coordinates_pointer, Ptr{Cdouble}, (Cint,))
+
+
+"""
+    trixi_get_state_layout(simstate_handle::Cint, layout::Ptr{StateLayout})::Cvoid
+
+Describe memory layout of internal data vector.
+
+The [`StateLayout`](@ref) stored in `layout` contains the pointer to the internal data array
+together with the strides required to address each variable at each node of each element.
+The information is only valid until the mesh changes.
+"""
+function trixi_get_state_layout end
+
+Base.@ccallable function trixi_get_state_layout(simstate_handle::Cint,
+                                                layout::Ptr{StateLayout})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    unsafe_store!(layout, trixi_get_state_layout_jl(simstate))
+    return nothing
+end
+
+trixi_get_state_layout_cfptr() =
+    @cfunction(trixi_get_state_layout, Cvoid, (Cint, Ptr{StateLayout}))
+
+
+"""
+    trixi_integrate_var(simstate_handle::Cint, variable_id::Cint)::Cdouble
+
+Return integral of conservative variable over the whole domain.
+
+The integral is computed using the quadrature weights and the volume elements of all
+elements, including the reduction over all MPI ranks. It is thus a collective operation.
+"""
+function trixi_integrate_var end
+
+Base.@ccallable function trixi_integrate_var(simstate_handle::Cint,
+                                             variable_id::Cint)::Cdouble
+    simstate = load_simstate(simstate_handle)
+    return trixi_integrate_var_jl(simstate, variable_id)
+end
+
+trixi_integrate_var_cfptr() = @cfunction(trixi_integrate_var, Cdouble, (Cint, Cint))
+
+
+"""
+    trixi_norm_var(simstate_handle::Cint, variable_id::Cint, l2::Ptr{Cdouble},
+                   linf::Ptr{Cdouble})::Cvoid
+
+Compute L2 and Linf norms of conservative variable over the whole domain.
+
+The L2 norm is normalized by the volume of the domain, as for the error norms of Trixi.jl's
+analysis callback. The Linf norm is the maximum absolute value at all nodes. Both norms are
+computed in a single pass and reduced over all MPI ranks, i.e., this is a collective
+operation.
+"""
+function trixi_norm_var end
+
+Base.@ccallable function trixi_norm_var(simstate_handle::Cint, variable_id::Cint,
+                                        l2::Ptr{Cdouble}, linf::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    l2_jl, linf_jl = trixi_norm_var_jl(simstate, variable_id)
+
+    unsafe_store!(l2, l2_jl)
+    unsafe_store!(linf, linf_jl)
+    return nothing
+end
+
+trixi_norm_var_cfptr() =
+    @cfunction(trixi_norm_var, Cvoid, (Cint, Cint, Ptr{Cdouble}, Ptr{Cdouble}))
+
+
+"""
+    trixi_minmax_var(simstate_handle::Cint, variable_id::Cint, min::Ptr{Cdouble},
+                     max::Ptr{Cdouble})::Cvoid
+
+Compute global minimum and maximum of conservative variable at all nodes.
+
+Both extrema are reduced over all MPI ranks in a single operation, i.e., this is a
+collective operation.
+"""
+function trixi_minmax_var end
+
+Base.@ccallable function trixi_minmax_var(simstate_handle::Cint, variable_id::Cint,
+                                          min::Ptr{Cdouble}, max::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+    min_jl, max_jl = trixi_minmax_var_jl(simstate, variable_id)
+
+    unsafe_store!(min, min_jl)
+    unsafe_store!(max, max_jl)
+    return nothing
+end
+
+trixi_minmax_var_cfptr() =
+    @cfunction(trixi_minmax_var, Cvoid, (Cint, Cint, Ptr{Cdouble}, Ptr{Cdouble}))
+
+
+"""
+    trixi_probe_create(simstate_handle::Cint, npoints::Cint, xyz::Ptr{Cdouble})::Cint
+
+Create probe for evaluating the solution at `npoints` physical points and return its index.
+
+Coordinate `d` of point `i` (both zero-based) is read from `xyz[d + ndims * i]`. The points
+are located once on the mesh and the containing elements as well as the interpolation
+weights are cached, such that evaluating the probe with [`trixi_probe_eval`](@ref) is
+independent of the total number of degrees of freedom. The probe becomes invalid if the
+mesh changes. Use [`trixi_probe_free`](@ref) to release a probe that is no longer needed;
+its index may then be returned again by a later call.
+
+This is a collective operation in parallel simulations.
+"""
+function trixi_probe_create end
+
+Base.@ccallable function trixi_probe_create(simstate_handle::Cint, npoints::Cint,
+                                            xyz::Ptr{Cdouble})::Cint
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia array
+    mesh, _, _, _ = mesh_equations_solver_cache(simstate.semi)
+    points = unsafe_wrap(Array, xyz, (ndims(mesh), npoints))
+
+    return trixi_probe_create_jl(simstate, points)
+end
+
+trixi_probe_create_cfptr() =
+    @cfunction(trixi_probe_create, Cint, (Cint, Cint, Ptr{Cdouble}))
+
+
+"""
+    trixi_probe_eval(simstate_handle::Cint, probe::Cint, nvariables::Cint,
+                     variable_ids::Ptr{Cint}, data::Ptr{Cdouble})::Cvoid
+
+Evaluate conservative variables at the points of a probe.
+
+The value of the conservative variable `variable_ids[j]` at point `i` (both zero-based) is
+stored in `data[i + npoints * j]`. The values are interpolated with the DG basis and are
+available on all MPI ranks, i.e., this is a collective operation. Points outside of the
+domain yield `NaN`.
+"""
+function trixi_probe_eval end
+
+Base.@ccallable function trixi_probe_eval(simstate_handle::Cint, probe::Cint,
+                                          nvariables::Cint, variable_ids::Ptr{Cint},
+                                          data::Ptr{Cdouble})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    npoints = length(load_probe(simstate, probe).owners)
+    variable_ids_jl = unsafe_wrap(Array, variable_ids, nvariables)
+    data_jl = unsafe_wrap(Array, data, (npoints, nvariables))
+
+    trixi_probe_eval_jl(simstate, probe, variable_ids_jl, data_jl)
+    return nothing
+end
+
+trixi_probe_eval_cfptr() =
+    @cfunction(trixi_probe_eval, Cvoid, (Cint, Cint, Cint, Ptr{Cint}, Ptr{Cdouble}))
+
+
+"""
+    trixi_probe_free(simstate_handle::Cint, probe::Cint)::Cvoid
+
+Free a probe created with [`trixi_probe_create`](@ref). The probe index becomes invalid and
+may be reused by subsequently created probes. Probes that became invalid due to a mesh
+change should be freed as well.
+"""
+function trixi_probe_free end
+
+Base.@ccallable function trixi_probe_free(simstate_handle::Cint, probe::Cint)::Cvoid
+    simstate = load_simstate(simstate_handle)
+    trixi_probe_free_jl(simstate, probe)
+    return nothing
+end
+
+trixi_probe_free_cfptr() = @cfunction(trixi_probe_free, Cvoid, (Cint, Cint))
+
+
 
 ############################################################################################
 # t8code
@@ -626,6 +1793,40 @@ trixi_get_t8code_forest_cfptr() =
     @cfunction(trixi_get_t8code_forest, Ptr{Trixi.t8_forest}, (Cint,))
 
 
+"""
+    trixi_load_element_tree_map(simstate_handle::Cint, tree_ids::Ptr{Cint},
+                                local_ids::Ptr{Cint})::Cvoid
+
+Load t8code tree and element index of each local element.
+
+For each local element, `tree_ids` receives the (0-based) local tree index and `local_ids`
+the (0-based) element index within this tree, as used by `t8_forest_get_element_in_tree`.
+Both arrays need to be of size `nelements`.
+
+!!! warning "Experimental"
+    The interface to t8code is experimental and implementation details may change at any
+    time without warning.
+"""
+function trixi_load_element_tree_map end
+
+Base.@ccallable function trixi_load_element_tree_map(simstate_handle::Cint,
+                                                     tree_ids::Ptr{Cint},
+                                                     local_ids::Ptr{Cint})::Cvoid
+    simstate = load_simstate(simstate_handle)
+
+    # convert C to Julia arrays
+    size = trixi_nelements_jl(simstate)
+    tree_ids_jl = unsafe_wrap(Array, tree_ids, size)
+    local_ids_jl = unsafe_wrap(Array, local_ids, size)
+
+    trixi_load_element_tree_map_jl(simstate, tree_ids_jl, local_ids_jl)
+    return nothing
+end
+
+trixi_load_element_tree_map_cfptr() =
+    @cfunction(trixi_load_element_tree_map, Cvoid, (Cint, Ptr{Cint}, Ptr{Cint}))
+
+
 
 ############################################################################################
 # Auxiliary
@@ -3,13 +3,18 @@
 ############################################################################################
 
 function trixi_initialize_simulation_jl(filename)
-    # Load elixir with simulation setup
-    Base.include(Main, abspath(filename))
-
-    # Initialize simulation state
-    # Note: we need `invokelatest` here since the function is dynamically upon `include`
-    # Note: `invokelatest` is not exported until Julia v1.9, thus we call it through `Base`
-    simstate = Base.invokelatest(Main.init_simstate)
+    # Loading the libelixir (re)defines `init_simstate` in `Main`, thus we need to prevent
+    # concurrent initializations from different threads
+    simstate = lock(libelixir_lock) do
+        # Load elixir with simulation setup
+        Base.include(Main, abspath(filename))
+
+        # Initialize simulation state
+        # Note: we need `invokelatest` here since the function is dynamically upon `include`
+        # Note: `invokelatest` is not exported until Julia v1.9, thus we call it through
+        # `Base`
+        return Base.invokelatest(Main.init_simstate)
+    end
 
     if show_debug_output()
         println("Simulation state initialized")
@@ -26,6 +31,10 @@ end
 
 
 function trixi_step_jl(simstate)
+    if simstate.checkpoint.blocks_step
+        wait_checkpoint!(simstate.checkpoint)
+    end
+
     step!(simstate.integrator)
 
     ret = check_error(simstate.integrator)
@@ -34,11 +43,107 @@ function trixi_step_jl(simstate)
         error("integrator failed to perform time step, return code: ", ret)
     end
 
+    # Callbacks (e.g., AMR) may have changed the mesh
+    check_mesh_change!(simstate)
+
+    return nothing
+end
+
+
+function trixi_step_n_jl(simstate, nsteps)
+    nsteps_done = 0
+    while nsteps_done < nsteps && !trixi_is_finished_jl(simstate)
+        trixi_step_jl(simstate)
+        nsteps_done += 1
+    end
+
+    return nsteps_done
+end
+
+
+function trixi_advance_to_time_jl(simstate, target_time)
+    integrator = simstate.integrator
+
+    # Force the integrator to step exactly onto the target time
+    if integrator.t < target_time < integrator.sol.prob.tspan[2]
+        add_tstop!(integrator, target_time)
+    end
+
+    nsteps_done = 0
+    while integrator.t < target_time && !trixi_is_finished_jl(simstate)
+        trixi_step_jl(simstate)
+        nsteps_done += 1
+    end
+
+    return nsteps_done
+end
+
+
+function trixi_rebalance_jl(simstate, element_weights)
+    if rebalance!(simstate, element_weights) && show_debug_output()
+        println("Mesh rebalanced, now ", trixi_nelements_jl(simstate), " local elements")
+    end
+
+    return trixi_nelements_jl(simstate)
+end
+
+
+function trixi_save_state_size_jl(simstate)
+    return snapshot_size(simstate.integrator)
+end
+
+
+function trixi_save_state_jl(simstate, buffer)
+    save_snapshot!(buffer, simstate.integrator)
+
+    return nothing
+end
+
+
+function trixi_restore_state_jl(simstate, buffer)
+    restore_snapshot!(simstate.integrator, buffer)
+
+    return nothing
+end
+
+
+function trixi_checkpoint_async_jl(simstate)
+    start_checkpoint!(simstate)
+
+    return nothing
+end
+
+
+function trixi_checkpoint_wait_jl(simstate)
+    wait_checkpoint!(simstate.checkpoint)
+
     return nothing
 end
 
 
+function trixi_write_restart_jl(simstate, filename)
+    write_restart(simstate, filename)
+
+    return nothing
+end
+
+
+function trixi_initialize_simulation_from_restart_jl(libelixir, restart_filename)
+    simstate = trixi_initialize_simulation_jl(libelixir)
+    load_restart!(simstate, restart_filename)
+
+    if show_debug_output()
+        println("Simulation state restarted from ", restart_filename)
+    end
+
+    return simstate
+end
+
+
 function trixi_finalize_simulation_jl(simstate)
+    # Make sure pending output is complete
+    wait_checkpoint!(simstate.checkpoint)
+
     # Run summary callback one final time
     for cb in simstate.integrator.opts.callback.discrete_callbacks
         if cb isa DiscreteCallback{<:Any, typeof(summary_callback)}
@@ -94,6 +199,24 @@ function trixi_nelementsglobal_jl(simstate)
 end
 
 
+function trixi_element_global_offset_jl(simstate)
+    if !Trixi.mpi_isparallel()
+        return 0
+    end
+
+    # elements are numbered consecutively across ranks in ascending order, the offset only
+    # changes with the mesh
+    tracker = simstate.mesh_tracker
+    if tracker.element_global_offset_epoch != tracker.epoch
+        offset = MPI.Exscan(trixi_nelements_jl(simstate), +, Trixi.mpi_comm())
+        tracker.element_global_offset = Trixi.mpi_rank() == 0 ? 0 : offset
+        tracker.element_global_offset_epoch = tracker.epoch
+    end
+
+    return tracker.element_global_offset
+end
+
+
 function trixi_ndofs_jl(simstate)
     mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
     return ndofs(mesh, solver, cache)
@@ -140,6 +263,32 @@ function trixi_load_node_weights_jl(simstate, data)
 end
 
 
+function trixi_load_node_coordinates_jl(simstate, data)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = n_nodes_per_dim^n_dims
+
+    # physical coordinates are stored as (ndims, nodes..., nelements) for all mesh types
+    node_coordinates = cache.elements.node_coordinates
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for element in eachelement(solver, cache)
+        for node_ci in node_cis
+            node_index = (element-1) * n_nodes + node_lis[node_ci]
+            for d in 1:n_dims
+                data[(node_index-1) * n_dims + d] = node_coordinates[d, node_ci, element]
+            end
+        end
+    end
+
+    return nothing
+end
+
+
 function trixi_load_conservative_var_jl(simstate, variable_id, data)
     mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
     n_nodes_per_dim = nnodes(solver)
@@ -165,6 +314,32 @@ function trixi_load_conservative_var_jl(simstate, variable_id, data)
 end
 
 
+function trixi_load_conservative_vars_jl(simstate, variable_ids, data)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = n_nodes_per_dim^n_dims
+
+    u_ode = simstate.integrator.u
+    u = wrap_array(u_ode, mesh, equations, solver, cache)
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for element in eachelement(solver, cache)
+        for node_ci in node_cis
+            node_index = (element-1) * n_nodes + node_lis[node_ci]
+            for (i, variable_id) in enumerate(variable_ids)
+                data[i][node_index] = u[variable_id, node_ci, element]
+            end
+        end
+    end
+
+    return nothing
+end
+
+
 function trixi_load_primitive_var_jl(simstate, variable_id, data)
     mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
     n_nodes_per_dim = nnodes(solver)
@@ -190,6 +365,35 @@ function trixi_load_primitive_var_jl(simstate, variable_id, data)
 end
 
 
+function trixi_load_primitive_vars_jl(simstate, variable_ids, data)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = n_nodes_per_dim^n_dims
+
+    u_ode = simstate.integrator.u
+    u = wrap_array(u_ode, mesh, equations, solver, cache)
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for element in eachelement(solver, cache)
+        for node_ci in node_cis
+            node_vars = get_node_vars(u, equations, solver, node_ci, element)
+            node_index = (element-1) * n_nodes + node_lis[node_ci]
+            # convert only once per node and scatter all requested variables
+            prim_vars = cons2prim(node_vars, equations)
+            for (i, variable_id) in enumerate(variable_ids)
+                data[i][node_index] = prim_vars[variable_id]
+            end
+        end
+    end
+
+    return nothing
+end
+
+
 function trixi_load_element_averaged_primitive_var_jl(simstate, variable_id, data)
     mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
     n_nodes = nnodes(solver)
@@ -250,8 +454,138 @@ function trixi_store_conservative_var_jl(simstate, variable_id, data)
 end
 
 
+# Validate element indices of a subset and return number of nodes per element
+function check_element_subset(simstate, elements)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_elements = nelements(solver, cache)
+    for element in elements
+        if !(1 <= element <= n_elements)
+            error("invalid element index ", element, " (expected 1 to ", n_elements, ")")
+        end
+    end
+
+    return nnodes(solver)^ndims(mesh)
+end
+
+
+function trixi_load_conservative_var_elements_jl(simstate, variable_id, elements, data)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = check_element_subset(simstate, elements)
+
+    u_ode = simstate.integrator.u
+    u = wrap_array(u_ode, mesh, equations, solver, cache)
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for (k, element) in enumerate(elements)
+        for node_ci in node_cis
+            node_index = (k-1) * n_nodes + node_lis[node_ci]
+            data[node_index] = u[variable_id, node_ci, element]
+        end
+    end
+
+    return nothing
+end
+
+
+function trixi_load_primitive_var_elements_jl(simstate, variable_id, elements, data)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = check_element_subset(simstate, elements)
+
+    u_ode = simstate.integrator.u
+    u = wrap_array(u_ode, mesh, equations, solver, cache)
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for (k, element) in enumerate(elements)
+        for node_ci in node_cis
+            node_vars = get_node_vars(u, equations, solver, node_ci, element)
+            node_index = (k-1) * n_nodes + node_lis[node_ci]
+            data[node_index] = cons2prim(node_vars, equations)[variable_id]
+        end
+    end
+
+    return nothing
+end
+
+
+function trixi_store_conservative_var_elements_jl(simstate, variable_id, elements, data)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_nodes_per_dim = nnodes(solver)
+    n_dims = ndims(mesh)
+    n_nodes = check_element_subset(simstate, elements)
+
+    u_ode = simstate.integrator.u
+    u = wrap_array(u_ode, mesh, equations, solver, cache)
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes_per_dim, n_dims))
+    node_lis = LinearIndices(node_cis)
+
+    for (k, element) in enumerate(elements)
+        for node_ci in node_cis
+            node_index = (k-1) * n_nodes + node_lis[node_ci]
+            u[variable_id, node_ci, element] = data[node_index]
+        end
+    end
+
+    return nothing
+end
+
+
+function trixi_nboundary_faces_jl(simstate, name)
+    return nboundary_faces(simstate, name)
+end
+
+
+function trixi_load_boundary_face_elements_jl(simstate, name, elements)
+    _, _, _, cache = mesh_equations_solver_cache(simstate.semi)
+    for (i, face) in enumerate(boundary_faces(simstate, name))
+        elements[i] = cache.boundaries.neighbor_ids[face]
+    end
+    return nothing
+end
+
+
+function trixi_load_boundary_node_coordinates_jl(simstate, name, data)
+    load_boundary_node_coordinates!(data, simstate, name)
+    return nothing
+end
+
+
+function trixi_load_boundary_conservative_var_jl(simstate, name, variable_id, data)
+    load_boundary_var!(data, simstate, name, variable_id, Trixi.cons2cons)
+    return nothing
+end
+
+
+function trixi_load_boundary_primitive_var_jl(simstate, name, variable_id, data)
+    load_boundary_var!(data, simstate, name, variable_id, cons2prim)
+    return nothing
+end
+
+
+function trixi_register_boundary_data_jl(simstate, name, data)
+    register_boundary_data!(simstate, name, data)
+    if show_debug_output()
+        println("New boundary data registered for boundary ", name)
+    end
+    return nothing
+end
+
+
 function trixi_register_data_jl(simstate, index, data)
     simstate.registry[index] = data
+    # data is owned by the user and no longer transferred on mesh changes
+    delete!(simstate.registry_fields.ncomponents, index)
     if show_debug_output()
         println("New data vector registered at index ", index)
     end
@@ -259,11 +593,122 @@ function trixi_register_data_jl(simstate, index, data)
 end
 
 
+function trixi_registry_alloc_jl(simstate, index, ncomponents)
+    data = registry_alloc!(simstate, index, ncomponents)
+    if show_debug_output()
+        println("New field with ", ncomponents, " components allocated at index ", index)
+    end
+    return data
+end
+
+
+function trixi_registry_get_pointer_jl(simstate, index)
+    if !haskey(simstate.registry_fields.ncomponents, index)
+        error("no field allocated by libtrixi at registry index ", index)
+    end
+    return pointer(simstate.registry[index])
+end
+
+
+function trixi_register_source_terms_jl(simstate, source_terms, userdata)
+    if !(simstate.semi.source_terms isa LibTrixiSourceTerms)
+        error("source terms of the semidiscretization are not of type LibTrixiSourceTerms")
+    end
+
+    simstate.semi.source_terms.callback = source_terms
+    simstate.semi.source_terms.userdata = userdata
+    if show_debug_output()
+        println("New source terms function registered")
+    end
+    return nothing
+end
+
+
+function trixi_set_refinement_indicator_jl(simstate, indicator)
+    refinement_indicator = find_refinement_indicator(simstate.integrator)
+    if refinement_indicator === nothing
+        error("AMR controller does not use an indicator of type LibTrixiRefinementIndicator")
+    end
+
+    refinement_indicator.alpha = indicator
+    refinement_indicator.is_set = true
+    if show_debug_output()
+        println("New refinement indicator set")
+    end
+    return nothing
+end
+
+
+function trixi_mesh_epoch_jl(simstate)
+    return simstate.mesh_tracker.epoch
+end
+
+
+function trixi_register_mesh_change_callback_jl(simstate, callback, userdata)
+    simstate.mesh_tracker.callback = callback
+    simstate.mesh_tracker.userdata = userdata
+    if show_debug_output()
+        println("New mesh change callback registered")
+    end
+    return nothing
+end
+
+
 function trixi_get_conservative_vars_pointer_jl(simstate)
     return pointer(simstate.integrator.u)
 end
 
 
+function trixi_get_node_coordinates_pointer_jl(simstate)
+    _, _, _, cache = mesh_equations_solver_cache(simstate.semi)
+    return pointer(cache.elements.node_coordinates)
+end
+
+
+function trixi_get_state_layout_jl(simstate)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_variables = nvariables(equations)
+    n_nodes = nnodes(solver)^ndims(mesh)
+
+    # Trixi.jl stores `u` as a contiguous array of size (nvariables, nodes..., nelements)
+    return StateLayout(pointer(simstate.integrator.u), STATE_LAYOUT_VERSION, ndims(mesh),
+                       nnodes(solver), n_variables, n_nodes, nelements(solver, cache),
+                       1, n_variables, n_variables * n_nodes)
+end
+
+
+function trixi_integrate_var_jl(simstate, variable_id)
+    return integrate_var(simstate, variable_id)
+end
+
+
+function trixi_norm_var_jl(simstate, variable_id)
+    return norm_var(simstate, variable_id)
+end
+
+
+function trixi_minmax_var_jl(simstate, variable_id)
+    return minmax_var(simstate, variable_id)
+end
+
+
+function trixi_probe_create_jl(simstate, points)
+    return store_probe!(simstate, create_probe(simstate, points))
+end
+
+
+function trixi_probe_eval_jl(simstate, probe, variable_ids, data)
+    eval_probe!(data, simstate, load_probe(simstate, probe), variable_ids)
+    return nothing
+end
+
+
+function trixi_probe_free_jl(simstate, probe)
+    delete_probe!(simstate, probe)
+    return nothing
+end
+
+
 function trixi_get_simulation_time_jl(simstate)
     return simstate.integrator.t
 end
@@ -274,6 +719,28 @@ function trixi_get_t8code_forest_jl(simstate)
     return mesh.forest.pointer
 end
 
+
+function trixi_load_element_tree_map_jl(simstate, tree_ids, local_ids)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(mesh isa Trixi.T8codeMesh)
+        error("element tree map is only available for T8codeMesh")
+    end
+
+    # Trixi.jl stores the local elements in the order of the forest, i.e., tree by tree
+    forest = mesh.forest.pointer
+    element = 0
+    for itree in 0:(Trixi.t8_forest_get_num_local_trees(forest) - 1)
+        for ielement in 0:(Trixi.t8_forest_get_tree_num_elements(forest, itree) - 1)
+            element += 1
+            tree_ids[element] = itree
+            local_ids[element] = ielement
+        end
+    end
+    @assert element == nelements(solver, cache)
+
+    return nothing
+end
+
 ############################################################################################
 # Auxiliary
 ############################################################################################
@@ -0,0 +1,208 @@
+# Access to data on named boundaries, see `trixi_nboundary_faces`
+#
+# Boundary faces are enumerated in the order of Trixi.jl's boundary container, the nodes of
+# each face in the order of its `node_indices`. Data on boundary faces is always stored as
+# (nnodes^(ndims-1), nfaces) and only requires touching the volume nodes on the boundary.
+#
+# Boundary conditions only receive the coordinates of a node, thus registered boundary data
+# is identified by node coordinates. Nodes shared by two faces of the same boundary use the
+# values of the latter face. Trixi.jl evaluates the boundary condition for the faces of a
+# boundary in the order of its boundary container, i.e., in the same order as the boundary
+# data. Thus, the node expected next is checked first, which only requires comparing its
+# coordinates. Only if the nodes are visited in a different order, e.g., with multiple
+# threads, the node is looked up in a hash table.
+
+"""
+    LibTrixiBoundaryCondition()
+
+Boundary condition with external boundary states provided by a C buffer registered via
+[`trixi_register_boundary_data`](@ref). Pass one instance per boundary name as boundary
+condition to the semidiscretization in `init_simstate()` of the libelixir.
+
+The buffer holds the conservative variables of the outer state at each node of each
+boundary face and is read directly whenever the boundary fluxes are computed, i.e., it can
+be updated by the caller between time steps. The flux is computed by the surface flux of the
+solver. Since the boundary faces depend on the mesh, the buffer needs to be registered again
+after each mesh change.
+"""
+mutable struct LibTrixiBoundaryCondition
+    data::Vector{Float64}
+    # Coordinates of each boundary node in the order of `data`
+    node_keys::Vector{NTuple{3, Float64}}
+    # Offset of the outer state in `data` for each boundary node in the order of `data`
+    offsets::Vector{Int}
+    # Index of each boundary node by node coordinates
+    nodes::Dict{NTuple{3, Float64}, Int}
+    # Index of the boundary node expected in the next call
+    next_node::Int
+
+    function LibTrixiBoundaryCondition()
+        return new(Float64[], NTuple{3, Float64}[], Int[], Dict{NTuple{3, Float64}, Int}(),
+                   1)
+    end
+end
+
+# Lookup key of a node, padded to three dimensions
+boundary_node_key(x) = ntuple(d -> d <= length(x) ? Float64(x[d]) : 0.0, 3)
+
+function (boundary_condition::LibTrixiBoundaryCondition)(u_inner,
+                                                         normal_direction::AbstractVector,
+                                                         x, t, surface_flux_function,
+                                                         equations)
+    key = boundary_node_key(x)
+    node = boundary_condition.next_node
+    node_keys = boundary_condition.node_keys
+    if !(node <= length(node_keys) && node_keys[node] == key)
+        node = get(boundary_condition.nodes, key, 0)
+        if node == 0
+            error("no boundary data registered for boundary node at ", x)
+        end
+    end
+    boundary_condition.next_node = node < length(node_keys) ? node + 1 : 1
+
+    offset = boundary_condition.offsets[node]
+    data = boundary_condition.data
+    u_boundary = Trixi.SVector(ntuple(v -> data[offset + v], Val(nvariables(equations))))
+    return surface_flux_function(u_inner, u_boundary, normal_direction, equations)
+end
+
+# Volume node index in one direction of face node `face_node_ci`, given the corresponding
+# entry of Trixi.jl's `node_indices` of the boundary
+function boundary_volume_index(node_index, face_node_ci, n_nodes)
+    if node_index === :begin
+        return 1
+    elseif node_index === :end
+        return n_nodes
+    elseif node_index === :i_forward
+        return face_node_ci[1]
+    elseif node_index === :i_backward
+        return n_nodes + 1 - face_node_ci[1]
+    elseif node_index === :j_forward
+        return face_node_ci[2]
+    else # :j_backward
+        return n_nodes + 1 - face_node_ci[2]
+    end
+end
+
+# Return the boundary condition of boundary `name` or `nothing` if there is none
+function find_boundary_condition(semi, name)
+    if !(semi.boundary_conditions isa Trixi.UnstructuredSortedBoundaryTypes)
+        return nothing
+    end
+
+    return get(semi.boundary_conditions.boundary_dictionary, Symbol(name), nothing)
+end
+
+# Return the local boundary indices with name `name`
+function boundary_faces(simstate, name)
+    mesh, _, _, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(mesh isa Trixi.P4estMesh || mesh isa Trixi.T8codeMesh)
+        error("boundary data is only available for P4estMesh and T8codeMesh")
+    end
+    # ranks without faces on a boundary still know its name
+    if find_boundary_condition(simstate.semi, name) === nothing
+        error("unknown boundary name ", name)
+    end
+
+    return findall(==(Symbol(name)), cache.boundaries.name)
+end
+
+# Call `f(index, node_ci, element)` for all nodes of all faces of boundary `name`, where
+# `index` is the position of the node in boundary data and `node_ci` the volume node index
+function foreach_boundary_node(f, simstate, name)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    faces = boundary_faces(simstate, name)
+    n_nodes = nnodes(solver)
+    n_dims = ndims(mesh)
+    boundaries = cache.boundaries
+
+    # all permutations of face node indices for arbitrary dimension
+    face_node_cis = CartesianIndices(ntuple(i -> n_nodes, n_dims - 1))
+
+    index = 0
+    for face in faces
+        element = boundaries.neighbor_ids[face]
+        node_indices = boundaries.node_indices[face]
+        for face_node_ci in face_node_cis
+            node_ci = CartesianIndex(ntuple(d -> boundary_volume_index(node_indices[d],
+                                                                       Tuple(face_node_ci),
+                                                                       n_nodes),
+                                            n_dims))
+            index += 1
+            f(index, node_ci, element)
+        end
+    end
+
+    return nothing
+end
+
+function nboundary_faces(simstate, name)
+    return length(boundary_faces(simstate, name))
+end
+
+function nboundary_nodes(simstate, name)
+    mesh, _, solver, _ = mesh_equations_solver_cache(simstate.semi)
+    return nboundary_faces(simstate, name) * nnodes(solver)^(ndims(mesh) - 1)
+end
+
+function load_boundary_node_coordinates!(data, simstate, name)
+    mesh, _, _, cache = mesh_equations_solver_cache(simstate.semi)
+    n_dims = ndims(mesh)
+    node_coordinates = cache.elements.node_coordinates
+
+    foreach_boundary_node(simstate, name) do index, node_ci, element
+        for d in 1:n_dims
+            data[(index - 1) * n_dims + d] = node_coordinates[d, node_ci, element]
+        end
+    end
+
+    return nothing
+end
+
+function load_boundary_var!(data, simstate, name, variable_id, conversion)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(1 <= variable_id <= nvariables(equations))
+        error("invalid variable id ", variable_id, " (expected 1 to ",
+              nvariables(equations), ")")
+    end
+    u = wrap_array(simstate.integrator.u, mesh, equations, solver, cache)
+
+    foreach_boundary_node(simstate, name) do index, node_ci, element
+        u_node = get_node_vars(u, equations, solver, Tuple(node_ci)..., element)
+        data[index] = conversion(u_node, equations)[variable_id]
+    end
+
+    return nothing
+end
+
+function register_boundary_data!(simstate, name, data)
+    boundary_condition = find_boundary_condition(simstate.semi, name)
+    if !(boundary_condition isa LibTrixiBoundaryCondition)
+        error("boundary condition of ", name, " is not of type LibTrixiBoundaryCondition")
+    end
+
+    _, equations, _, cache = mesh_equations_solver_cache(simstate.semi)
+    n_variables = nvariables(equations)
+    if length(data) != nboundary_nodes(simstate, name) * n_variables
+        error("boundary data has ", length(data), " values, expected ",
+              nboundary_nodes(simstate, name) * n_variables)
+    end
+
+    node_coordinates = cache.elements.node_coordinates
+    node_keys = Vector{NTuple{3, Float64}}(undef, nboundary_nodes(simstate, name))
+    nodes = Dict{NTuple{3, Float64}, Int}()
+    foreach_boundary_node(simstate, name) do index, node_ci, element
+        node_keys[index] = boundary_node_key(view(node_coordinates, :, node_ci, element))
+        nodes[node_keys[index]] = index
+    end
+    # shared nodes use the values of the latter face
+    offsets = [(nodes[key] - 1) * n_variables for key in node_keys]
+
+    boundary_condition.data = data
+    boundary_condition.node_keys = node_keys
+    boundary_condition.offsets = offsets
+    boundary_condition.nodes = nodes
+    boundary_condition.next_node = 1
+
+    return nothing
+end
@@ -0,0 +1,97 @@
+# Asynchronous checkpoints, see `trixi_checkpoint_async`
+
+# Serialize writing checkpoints of different simulations, since HDF5 is not thread-safe
+const checkpoint_io_lock = ReentrantLock()
+
+# Return the `SaveSolutionCallback` of the integrator or `nothing` if there is none
+function find_save_solution_callback(integrator)
+    for cb in integrator.opts.callback.discrete_callbacks
+        if cb.affect! isa Trixi.SaveSolutionCallback
+            return cb.affect!
+        end
+    end
+
+    return nothing
+end
+
+function has_amr_callback(integrator)
+    return any(cb -> cb.affect! isa Trixi.AMRCallback,
+               integrator.opts.callback.discrete_callbacks)
+end
+
+# Writing in the background requires a second thread. Parallel output uses collective
+# operations on Trixi.jl's communicator, which must not overlap with the collectives of the
+# time stepping (e.g., in the step size callback) even with `MPI_THREAD_MULTIPLE`, thus
+# parallel checkpoints are always written synchronously.
+function checkpoint_can_overlap()
+    return Threads.nthreads() > 1 && !Trixi.mpi_isparallel()
+end
+
+function start_checkpoint!(simstate)
+    checkpoint = simstate.checkpoint
+    integrator = simstate.integrator
+    semi = simstate.semi
+
+    # Only one checkpoint per simulation may be pending
+    wait_checkpoint!(checkpoint)
+
+    # Output settings (directory, solution variables) are taken from the libelixir
+    solution_callback = find_save_solution_callback(integrator)
+    if isnothing(solution_callback)
+        error("asynchronous checkpoints require a `SaveSolutionCallback` in the libelixir")
+    end
+
+    # Everything that depends on the current state is done synchronously
+    t = integrator.t
+    dt = integrator.dt
+    iter = integrator.stats.naccept
+    Trixi.save_mesh(semi, solution_callback.output_directory, iter)
+
+    # Stage solution, memory is only reallocated if the number of DOFs changed
+    u = checkpoint.u
+    resize!(u, length(integrator.u))
+    copyto!(u, integrator.u)
+
+    # Additional output variables may alias internal buffers that are modified while
+    # stepping, thus they need to be copied as well
+    element_variables = Dict{Symbol, Any}()
+    Trixi.get_element_variables!(element_variables, u, semi)
+    node_variables = Dict{Symbol, Any}()
+    Trixi.get_node_variables!(node_variables, u, semi)
+    for variables in (element_variables, node_variables), (key, value) in variables
+        variables[key] = copy(value)
+    end
+
+    write_checkpoint = () -> lock(checkpoint_io_lock) do
+        Trixi.save_solution_file(u, t, dt, iter, semi, solution_callback,
+                                 element_variables, node_variables)
+        return nothing
+    end
+
+    if checkpoint_can_overlap()
+        checkpoint.task = Threads.@spawn write_checkpoint()
+        checkpoint.blocks_step = has_amr_callback(integrator)
+    else
+        write_checkpoint()
+    end
+
+    if show_debug_output()
+        println("Checkpoint for step ", iter, " started")
+    end
+
+    return nothing
+end
+
+# Wait for pending checkpoint (if any), errors during writing are rethrown
+function wait_checkpoint!(checkpoint)
+    task = checkpoint.task
+    if isnothing(task)
+        return nothing
+    end
+
+    checkpoint.task = nothing
+    checkpoint.blocks_step = false
+    wait(task)
+
+    return nothing
+end
@@ -0,0 +1,38 @@
+# Detection of mesh changes, see `trixi_mesh_epoch`
+#
+# Trixi.jl re-wraps the arrays of the element container whenever it is resized during mesh
+# adaptation or repartitioning. Comparing the identity of the node coordinates array after
+# each time step thus detects mesh changes in O(1), independent of the number of elements.
+
+# Update the mesh epoch if the mesh has changed and notify the registered C function, return
+# true if the mesh has changed. Registry fields are transferred to the new mesh, unless this
+# has already been done by the caller.
+function check_mesh_change!(simstate; transfer_registry = true)
+    tracker = simstate.mesh_tracker
+    _, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if cache.elements.node_coordinates === tracker.node_coordinates
+        return false
+    end
+
+    nelements_old = tracker.nelements
+    tracker.epoch += 1
+    tracker.node_coordinates = cache.elements.node_coordinates
+    tracker.nelements = nelements(solver, cache)
+
+    if show_debug_output()
+        println("Mesh changed (epoch ", tracker.epoch, "): ", nelements_old, " -> ",
+                tracker.nelements, " elements")
+    end
+
+    # Registry fields need to be valid when the C function is notified
+    if transfer_registry
+        transfer_registry_fields!(simstate)
+    end
+
+    if tracker.callback != C_NULL
+        ccall(tracker.callback, Cvoid, (Cint, Cint, Cint, Ptr{Cvoid}),
+              tracker.epoch, nelements_old, tracker.nelements, tracker.userdata)
+    end
+
+    return true
+end
@@ -0,0 +1,225 @@
+# Point probes, see `trixi_probe_create`
+#
+# When a probe is created, each point is located once on the local mesh and the containing
+# element as well as the Lagrange interpolation weights of its reference coordinates are
+# cached. Evaluating a probe then only touches the `nnodes^ndims` nodes of one element per
+# point. In parallel simulations, each point is owned by the lowest rank containing it.
+
+# Tolerance for accepting reference coordinates slightly outside of [-1, 1]
+const PROBE_TOLERANCE = 1e-10
+# Maximum number of Newton iterations to invert the mapping of an element
+const PROBE_MAX_ITERATIONS = 20
+
+# Evaluate mapping of `element` and its Jacobian at reference coordinates with Lagrange
+# basis values `basis[:, d]` and derivatives `basis_derivative[:, d]` in each direction
+function evaluate_mapping!(x, jacobian, node_coordinates, basis, basis_derivative,
+                           node_cis, element)
+    n_dims = length(x)
+    fill!(x, 0)
+    fill!(jacobian, 0)
+    for node_ci in node_cis
+        indices = Tuple(node_ci)
+        weight = 1.0
+        for d in 1:n_dims
+            weight *= basis[indices[d], d]
+        end
+        for k in 1:n_dims
+            # derivative in direction `k` of the tensor product basis function
+            weight_k = basis_derivative[indices[k], k]
+            for d in 1:n_dims
+                if d != k
+                    weight_k *= basis[indices[d], d]
+                end
+            end
+            for d in 1:n_dims
+                jacobian[d, k] += weight_k * node_coordinates[d, node_ci, element]
+            end
+        end
+        for d in 1:n_dims
+            x[d] += weight * node_coordinates[d, node_ci, element]
+        end
+    end
+
+    return nothing
+end
+
+# Find reference coordinates `xi` of `point` in `element` using Newton's method, return true
+# if the point is located inside the element
+function locate_in_element!(xi, point, node_coordinates, nodes, wbary, derivative_matrix,
+                            node_cis, element)
+    n_dims = length(point)
+    n_nodes = length(nodes)
+    x = zeros(n_dims)
+    jacobian = zeros(n_dims, n_dims)
+    basis = zeros(n_nodes, n_dims)
+    basis_derivative = zeros(n_nodes, n_dims)
+
+    fill!(xi, 0)
+    for _ in 1:PROBE_MAX_ITERATIONS
+        for d in 1:n_dims
+            basis[:, d] = Trixi.lagrange_interpolating_polynomials(xi[d], nodes, wbary)
+            # derivatives of the Lagrange polynomials are interpolated exactly
+            basis_derivative[:, d] = derivative_matrix' * basis[:, d]
+        end
+        evaluate_mapping!(x, jacobian, node_coordinates, basis, basis_derivative, node_cis,
+                          element)
+
+        delta = jacobian \ (point - x)
+        xi .+= delta
+        if maximum(abs, xi) > 2
+            # diverging, point is far outside of this element
+            return false
+        end
+        if maximum(abs, delta) < PROBE_TOLERANCE
+            break
+        end
+    end
+
+    return maximum(abs, xi) <= 1 + PROBE_TOLERANCE
+end
+
+function create_probe(simstate, points)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_dims = ndims(mesh)
+    if size(points, 1) != n_dims
+        error("points must have ", n_dims, " coordinates, got ", size(points, 1))
+    end
+    npoints = size(points, 2)
+
+    nodes = solver.basis.nodes
+    n_nodes = nnodes(solver)
+    wbary = Trixi.barycentric_weights(nodes)
+    derivative_matrix = Trixi.polynomial_derivative_matrix(nodes)
+    node_coordinates = cache.elements.node_coordinates
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes, n_dims))
+
+    # Bounding boxes of all elements, enlarged to account for curved faces
+    n_elements = nelements(solver, cache)
+    box_min = zeros(n_dims, n_elements)
+    box_max = zeros(n_dims, n_elements)
+    for element in eachelement(solver, cache), d in 1:n_dims
+        coordinates = view(node_coordinates, d, node_cis, element)
+        lower, upper = extrema(coordinates)
+        margin = 0.1 * (upper - lower)
+        box_min[d, element] = lower - margin
+        box_max[d, element] = upper + margin
+    end
+
+    elements = zeros(Int, npoints)
+    interpolation_weights = zeros(n_nodes, n_dims, npoints)
+    xi = zeros(n_dims)
+    for i in 1:npoints
+        point = points[:, i]
+        for element in eachelement(solver, cache)
+            if any(d -> !(box_min[d, element] <= point[d] <= box_max[d, element]),
+                   1:n_dims)
+                continue
+            end
+            if locate_in_element!(xi, point, node_coordinates, nodes, wbary,
+                                  derivative_matrix, node_cis, element)
+                elements[i] = element
+                for d in 1:n_dims
+                    xi_d = clamp(xi[d], -1, 1)
+                    interpolation_weights[:, d, i] =
+                        Trixi.lagrange_interpolating_polynomials(xi_d, nodes, wbary)
+                end
+                break
+            end
+        end
+    end
+
+    # Assign each point to the lowest rank containing it, `-1` marks points outside of the
+    # domain
+    nranks = Trixi.mpi_nranks()
+    owners = [element > 0 ? Trixi.mpi_rank() : nranks for element in elements]
+    owners = allreduce(owners, min)
+    owners[owners .== nranks] .= -1
+
+    return Probe(elements, interpolation_weights, owners, simstate.mesh_tracker.epoch)
+end
+
+# Store probe in the first free slot and return its (one-based) index
+function store_probe!(simstate, probe)
+    slot = findfirst(isnothing, simstate.probes)
+    if isnothing(slot)
+        push!(simstate.probes, probe)
+        return length(simstate.probes)
+    end
+
+    simstate.probes[slot] = probe
+    return slot
+end
+
+function load_probe(simstate, index)
+    if !(1 <= index <= length(simstate.probes)) || isnothing(simstate.probes[index])
+        error("the provided probe was not found: ", index)
+    end
+
+    return simstate.probes[index]
+end
+
+# Free the slot of a probe for reuse by `store_probe!`
+function delete_probe!(simstate, index)
+    load_probe(simstate, index)
+    simstate.probes[index] = nothing
+
+    # Shrink storage if the last probes have been freed
+    while !isempty(simstate.probes) && isnothing(last(simstate.probes))
+        pop!(simstate.probes)
+    end
+
+    return nothing
+end
+
+function eval_probe!(data, simstate, probe, variable_ids)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if simstate.mesh_tracker.epoch != probe.mesh_epoch
+        error("mesh has changed since probe was created")
+    end
+    for variable_id in variable_ids
+        if !(1 <= variable_id <= nvariables(equations))
+            error("invalid variable id ", variable_id, " (expected 1 to ",
+                  nvariables(equations), ")")
+        end
+    end
+
+    u = wrap_array(simstate.integrator.u, mesh, equations, solver, cache)
+    n_dims = ndims(mesh)
+    rank = Trixi.mpi_rank()
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> nnodes(solver), n_dims))
+
+    fill!(data, 0)
+    for i in eachindex(probe.owners)
+        if probe.owners[i] != rank
+            continue
+        end
+
+        element = probe.elements[i]
+        for node_ci in node_cis
+            indices = Tuple(node_ci)
+            weight = 1.0
+            for d in 1:n_dims
+                weight *= probe.interpolation_weights[indices[d], d, i]
+            end
+            for (j, variable_id) in enumerate(variable_ids)
+                data[i, j] += weight * u[variable_id, node_ci, element]
+            end
+        end
+    end
+
+    # Gather values from all owning ranks
+    if Trixi.mpi_isparallel()
+        MPI.Allreduce!(data, +, Trixi.mpi_comm())
+    end
+    for i in eachindex(probe.owners)
+        if probe.owners[i] < 0
+            data[i, :] .= NaN
+        end
+    end
+
+    return nothing
+end
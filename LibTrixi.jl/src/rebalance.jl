@@ -0,0 +1,105 @@
+# Weighted repartitioning of the mesh, see `trixi_rebalance`
+#
+# p4est only accepts integer weights computed by a C function, which is called for all local
+# quadrants in the order of the forest, i.e., in the same order as Trixi.jl's elements. The
+# weights passed by the user are thus scaled to integers beforehand and handed out by a
+# counter. Since the C callback cannot capture any state, the weights and the counter are
+# global and only accessed while holding `rebalance_lock`, such that simulations may be
+# rebalanced concurrently from different threads.
+
+# Integer weight assigned to the heaviest element
+const REBALANCE_WEIGHT_SCALE = 1000
+
+const rebalance_weights = Cint[]
+const rebalance_counter = Ref(0)
+const rebalance_lock = ReentrantLock()
+
+function rebalance_weight(p4est::Ptr{Cvoid}, which_tree::Int32, quadrant::Ptr{Cvoid})::Cint
+    rebalance_counter[] += 1
+    return rebalance_weights[rebalance_counter[]]
+end
+
+# Number of elements owned by `old_rank` before and by `new_rank` after repartitioning,
+# given the global index of the first element on each rank (0-based, with the total number
+# of elements appended)
+function count_moved_elements(old_first_ids, old_rank, new_first_ids, new_rank)
+    first = max(old_first_ids[old_rank + 1], new_first_ids[new_rank + 1])
+    last = min(old_first_ids[old_rank + 2], new_first_ids[new_rank + 2])
+    return max(0, last - first)
+end
+
+# Send data of each element to its new owner, `data` holds `blocksize` values per element
+function migrate_elements(data, blocksize, old_first_ids, new_first_ids)
+    nranks = Trixi.mpi_nranks()
+    rank = Trixi.mpi_rank()
+    send_counts = [count_moved_elements(old_first_ids, rank, new_first_ids, other)
+                   for other in 0:(nranks - 1)] .* blocksize
+    recv_counts = [count_moved_elements(old_first_ids, other, new_first_ids, rank)
+                   for other in 0:(nranks - 1)] .* blocksize
+
+    # elements are kept in global order, such that all ranges are contiguous
+    new_data = zeros(sum(recv_counts))
+    MPI.Alltoallv!(MPI.VBuffer(data, send_counts), MPI.VBuffer(new_data, recv_counts),
+                   Trixi.mpi_comm())
+
+    return new_data
+end
+
+function rebalance!(simstate, element_weights)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(mesh isa Trixi.P4estMesh)
+        error("weighted rebalancing is only available for P4estMesh")
+    end
+    if length(element_weights) != nelements(solver, cache)
+        error("expected ", nelements(solver, cache), " element weights, got ",
+              length(element_weights))
+    end
+    if any(weight -> !(isfinite(weight) && weight >= 0), element_weights)
+        error("element weights must be finite and non-negative")
+    end
+    if !Trixi.mpi_isparallel()
+        return false
+    end
+
+    max_weight = allreduce(maximum(element_weights; init = 0.0), max)
+    if max_weight == 0
+        error("at least one element weight must be positive")
+    end
+
+    # Partition the forest and redistribute the solution as done by Trixi.jl's AMR callback
+    old_first_ids = copy(Trixi.get_global_first_element_ids(mesh))
+    weight_fn = @cfunction(rebalance_weight, Cint, (Ptr{Cvoid}, Int32, Ptr{Cvoid}))
+    lock(rebalance_lock) do
+        resize!(rebalance_weights, length(element_weights))
+        @. rebalance_weights = round(Cint,
+                                     REBALANCE_WEIGHT_SCALE * element_weights / max_weight)
+        rebalance_counter[] = 0
+        Trixi.partition!(mesh; weight_fn = weight_fn)
+        @assert rebalance_counter[] == length(rebalance_weights)
+    end
+    new_first_ids = copy(Trixi.get_global_first_element_ids(mesh))
+    if new_first_ids == old_first_ids
+        return false
+    end
+
+    integrator = simstate.integrator
+    Trixi.rebalance_solver!(integrator.u, mesh, equations, solver, cache, old_first_ids)
+    Trixi.reinitialize_boundaries!(simstate.semi.boundary_conditions, cache)
+    resize!(integrator, length(integrator.u))
+    u_modified!(integrator, true)
+
+    # Registry fields are sent along with the elements, the volume-based transfer of
+    # `check_mesh_change!` only applies to local mesh adaptation
+    fields = simstate.registry_fields
+    if !isempty(fields.ncomponents)
+        n_nodes = nnodes(solver)^ndims(mesh)
+        for (index, ncomponents) in fields.ncomponents
+            simstate.registry[index] = migrate_elements(simstate.registry[index],
+                                                        ncomponents * n_nodes,
+                                                        old_first_ids, new_first_ids)
+        end
+        save_registry_mesh!(simstate)
+    end
+
+    return check_mesh_change!(simstate; transfer_registry = false)
+end
@@ -0,0 +1,84 @@
+# Global reductions of conservative variables, see `trixi_integrate_var`
+#
+# All reductions are computed in a single pass over the local data, followed by an MPI
+# reduction in parallel simulations. They are thus collective operations.
+
+# Volume element at a node: for `TreeMesh`, only the inverse Jacobian of the 1D mapping is
+# stored per element, for curvilinear meshes the inverse Jacobian is stored per node
+volume_jacobian(inverse_jacobian::AbstractVector, node_ci, element, n_dims) =
+    inv(inverse_jacobian[element])^n_dims
+volume_jacobian(inverse_jacobian, node_ci, element, n_dims) =
+    abs(inv(inverse_jacobian[node_ci, element]))
+
+# Fold `reduce_node(accumulator, value, weight)` over all local nodes, where `value` is the
+# conservative variable `variable_id` and `weight` the quadrature weight times the volume
+# element of the node
+function reduce_var(reduce_node, init, simstate, variable_id)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(1 <= variable_id <= nvariables(equations))
+        error("invalid variable id ", variable_id, " (expected 1 to ",
+              nvariables(equations), ")")
+    end
+
+    u = wrap_array(simstate.integrator.u, mesh, equations, solver, cache)
+    weights = solver.basis.weights
+    inverse_jacobian = cache.elements.inverse_jacobian
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> nnodes(solver), ndims(mesh)))
+
+    accumulator = init
+    for element in eachelement(solver, cache)
+        for node_ci in node_cis
+            weight = volume_jacobian(inverse_jacobian, node_ci, element, ndims(mesh))
+            for node_index in Tuple(node_ci)
+                weight *= weights[node_index]
+            end
+            accumulator = reduce_node(accumulator, u[variable_id, node_ci, element], weight)
+        end
+    end
+
+    return accumulator
+end
+
+function allreduce(values, op)
+    if Trixi.mpi_isparallel()
+        return MPI.Allreduce(values, op, Trixi.mpi_comm())
+    else
+        return values
+    end
+end
+
+function integrate_var(simstate, variable_id)
+    integral = reduce_var(0.0, simstate, variable_id) do integral, value, weight
+        integral + value * weight
+    end
+
+    return allreduce(integral, +)
+end
+
+# The L2 norm is normalized by the domain volume, consistent with the analysis callback
+function norm_var(simstate, variable_id)
+    function reduce_node((l2_squared, volume, linf), value, weight)
+        return (l2_squared + value^2 * weight, volume + weight, max(linf, abs(value)))
+    end
+    l2_squared, volume, linf = reduce_var(reduce_node, (0.0, 0.0, 0.0), simstate,
+                                          variable_id)
+
+    l2_squared, volume = allreduce([l2_squared, volume], +)
+    linf = allreduce(linf, max)
+
+    return sqrt(l2_squared / volume), linf
+end
+
+function minmax_var(simstate, variable_id)
+    function reduce_node((min_value, max_value), value, weight)
+        return (min(min_value, value), max(max_value, value))
+    end
+    min_value, max_value = reduce_var(reduce_node, (Inf, -Inf), simstate, variable_id)
+
+    # Reduce both extrema in a single call
+    minus_min_value, max_value = allreduce([-min_value, max_value], max)
+
+    return -minus_min_value, max_value
+end
@@ -0,0 +1,44 @@
+"""
+    LibTrixiRefinementIndicator()
+
+Refinement indicator with values computed outside of Trixi.jl and set via
+[`trixi_set_refinement_indicator`](@ref). Pass an instance as `indicator` to an AMR
+controller (e.g., `ControllerThreeLevel`) in `init_simstate()` of the libelixir.
+
+The indicator holds one value per local element. The values are not copied, but read
+directly from the memory passed by the user whenever the mesh is adapted. Since the number
+of elements changes with the mesh, the values need to be set again after each mesh change.
+"""
+mutable struct LibTrixiRefinementIndicator <: Trixi.AbstractIndicator
+    alpha::Vector{Float64}
+    is_set::Bool
+
+    LibTrixiRefinementIndicator() = new(Float64[], false)
+end
+
+function (indicator::LibTrixiRefinementIndicator)(u, mesh, equations, dg, cache; kwargs...)
+    if !indicator.is_set
+        error("no refinement indicator has been set")
+    end
+    if length(indicator.alpha) != nelements(dg, cache)
+        error("refinement indicator has ", length(indicator.alpha), " values, but mesh has ",
+              nelements(dg, cache), " elements")
+    end
+
+    return indicator.alpha
+end
+
+# Return the refinement indicator of the AMR controller or `nothing` if there is none
+function find_refinement_indicator(integrator)
+    for cb in integrator.opts.callback.discrete_callbacks
+        if cb.affect! isa Trixi.AMRCallback
+            controller = cb.affect!.controller
+            if hasproperty(controller, :indicator) &&
+               controller.indicator isa LibTrixiRefinementIndicator
+                return controller.indicator
+            end
+        end
+    end
+
+    return nothing
+end
@@ -0,0 +1,253 @@
+# Registry fields allocated by libtrixi, see `trixi_registry_alloc`
+#
+# Fields are stored with the same layout as the conservative variables, i.e., as an array
+# of size (ncomponents, nnodes..., nelements). When the mesh changes, the values are
+# transferred to the new mesh: mesh adaptation keeps the elements in space-filling curve
+# order, such that old and new elements can be matched in a single sweep by comparing
+# their accumulated volumes. Each group of matching elements is either copied unchanged or
+# projected with the refinement/coarsening operators of Trixi.jl's AMR adaptor. In parallel
+# simulations, old elements are first moved to the ranks owning the new elements.
+
+# Relative tolerance for matching the volumes of old and new elements
+const REGISTRY_VOLUME_TOLERANCE = 1e-3
+
+function element_volumes(simstate)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    weights = solver.basis.weights
+    inverse_jacobian = cache.elements.inverse_jacobian
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> nnodes(solver), ndims(mesh)))
+
+    volumes = zeros(nelements(solver, cache))
+    for element in eachelement(solver, cache), node_ci in node_cis
+        weight = volume_jacobian(inverse_jacobian, node_ci, element, ndims(mesh))
+        for node_index in Tuple(node_ci)
+            weight *= weights[node_index]
+        end
+        volumes[element] += weight
+    end
+
+    return volumes
+end
+
+# Remember the mesh the registry fields are currently defined on
+function save_registry_mesh!(simstate)
+    fields = simstate.registry_fields
+    fields.volumes = element_volumes(simstate)
+    return nothing
+end
+
+function wrap_registry_field(data, ncomponents, n_nodes, n_dims)
+    n_elements = div(length(data), ncomponents * n_nodes^n_dims)
+    return reshape(data, ncomponents, ntuple(i -> n_nodes, n_dims)..., n_elements)
+end
+
+function registry_alloc!(simstate, index, ncomponents)
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    if !(1 <= index <= length(simstate.registry))
+        error("invalid registry index ", index, " (expected 1 to ",
+              length(simstate.registry), ")")
+    end
+    if ncomponents < 1
+        error("number of components must be positive, got ", ncomponents)
+    end
+
+    fields = simstate.registry_fields
+    if isempty(fields.ncomponents)
+        save_registry_mesh!(simstate)
+    end
+
+    n_dofs = nnodes(solver)^ndims(mesh) * nelements(solver, cache)
+    simstate.registry[index] = zeros(ncomponents * n_dofs)
+    fields.ncomponents[index] = ncomponents
+
+    return pointer(simstate.registry[index])
+end
+
+# Match old and new elements by their volumes, return pairs of index ranges of old and new
+# elements covering the same region, or `nothing` if the meshes cannot be matched
+function match_elements(old_volumes, new_volumes)
+    groups = Tuple{UnitRange{Int}, UnitRange{Int}}[]
+    n_old = length(old_volumes)
+    n_new = length(new_volumes)
+
+    old_first = new_first = 1
+    while old_first <= n_old && new_first <= n_new
+        old_last = old_first
+        new_last = new_first
+        old_volume = old_volumes[old_first]
+        new_volume = new_volumes[new_first]
+        while !isapprox(old_volume, new_volume, rtol = REGISTRY_VOLUME_TOLERANCE)
+            if old_volume < new_volume
+                old_last += 1
+                old_last > n_old && return nothing
+                old_volume += old_volumes[old_last]
+            else
+                new_last += 1
+                new_last > n_new && return nothing
+                new_volume += new_volumes[new_last]
+            end
+        end
+        push!(groups, (old_first:old_last, new_first:new_last))
+        old_first = old_last + 1
+        new_first = new_last + 1
+    end
+
+    if old_first <= n_old || new_first <= n_new
+        return nothing
+    end
+
+    return groups
+end
+
+# Global index of the first element on each rank (0-based, with the total number of
+# elements appended), given the number of local elements
+function global_first_ids(n_elements)
+    counts = MPI.Allgather(n_elements, Trixi.mpi_comm())
+    return [0; cumsum(counts)]
+end
+
+# Mesh adaptation in parallel simulations is followed by repartitioning. Move the old
+# elements to the rank owning the new elements covering the same region, such that the
+# transfer only requires local data afterwards. Old and new elements are both in global
+# space-filling curve order, thus the destination of an old element is given by the position
+# of its volume midpoint among the new volume ranges of all ranks. Return the old volumes
+# and registry fields on this rank after migration.
+function migrate_registry_fields(old_volumes, new_volumes, old_data, blocksizes)
+    comm = Trixi.mpi_comm()
+    rank = Trixi.mpi_rank()
+    nranks = Trixi.mpi_nranks()
+
+    # Global volume range of the new elements of each rank
+    new_volume_offsets = [0; cumsum(MPI.Allgather(sum(new_volumes), comm))]
+
+    # Global volume midpoints of the old elements on this rank
+    old_volume_offset = MPI.Exscan(sum(old_volumes), +, comm)
+    old_volume_offset = rank == 0 ? 0.0 : old_volume_offset
+    midpoints = old_volume_offset .+ cumsum(old_volumes) .- 0.5 .* old_volumes
+
+    # Number of old elements (globally) that are sent to a rank before `r`, i.e., the global
+    # index of the first old element on each rank after migration
+    target_first_ids = [count(<(new_volume_offsets[r + 1]), midpoints) for r in 0:nranks]
+    target_first_ids[end] = length(old_volumes)
+    target_first_ids = MPI.Allreduce(target_first_ids, +, comm)
+    old_first_ids = global_first_ids(length(old_volumes))
+
+    volumes = migrate_elements(old_volumes, 1, old_first_ids, target_first_ids)
+    data = Dict(index => migrate_elements(old_data[index], blocksizes[index],
+                                          old_first_ids, target_first_ids)
+                for index in keys(old_data))
+
+    return volumes, data
+end
+
+# Apply the 1D operator `operators[d]` in each direction `d` to the values of `old_element`
+# and add the result to the values of `new_element`
+function add_tensor_product!(new_field, new_element, operators, old_field, old_element,
+                             node_cis)
+    for new_node_ci in node_cis, old_node_ci in node_cis
+        weight = 1.0
+        for d in eachindex(operators)
+            weight *= operators[d][new_node_ci[d], old_node_ci[d]]
+        end
+        for v in axes(new_field, 1)
+            new_field[v, new_node_ci, new_element] +=
+                weight * old_field[v, old_node_ci, old_element]
+        end
+    end
+
+    return nothing
+end
+
+# Transfer all registry fields allocated by libtrixi to the current mesh. Refined and
+# coarsened elements are treated with the same L2 projection operators that Trixi.jl applies
+# to the solution, where the children of an element are ordered in Morton order (i.e., the
+# position of child `c` in direction `d` is given by bit `d` of `c - 1`).
+function transfer_registry_fields!(simstate)
+    fields = simstate.registry_fields
+    if isempty(fields.ncomponents)
+        return nothing
+    end
+
+    mesh, _, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    n_dims = ndims(mesh)
+    n_nodes = nnodes(solver)
+    n_elements = nelements(solver, cache)
+    adaptor = Trixi.AdaptorL2(solver.basis)
+    n_children = 2^n_dims
+
+    # all permutations of nodes indices for arbitrary dimension
+    node_cis = CartesianIndices(ntuple(i -> n_nodes, n_dims))
+
+    old_volumes = fields.volumes
+    new_volumes = element_volumes(simstate)
+    old_data = Dict(index => simstate.registry[index] for index in keys(fields.ncomponents))
+    if Trixi.mpi_isparallel()
+        blocksizes = Dict(index => ncomponents * n_nodes^n_dims
+                          for (index, ncomponents) in fields.ncomponents)
+        old_volumes, old_data = migrate_registry_fields(old_volumes, new_volumes, old_data,
+                                                        blocksizes)
+    end
+
+    new_data = Dict(index => zeros(ncomponents * n_nodes^n_dims * n_elements)
+                    for (index, ncomponents) in fields.ncomponents)
+    old_fields = Dict(index => wrap_registry_field(old_data[index], ncomponents, n_nodes,
+                                                   n_dims)
+                      for (index, ncomponents) in fields.ncomponents)
+    new_fields = Dict(index => wrap_registry_field(new_data[index], ncomponents, n_nodes,
+                                                   n_dims)
+                      for (index, ncomponents) in fields.ncomponents)
+
+    # Each group has to be an unchanged, a refined, or a coarsened element
+    groups = match_elements(old_volumes, new_volumes)
+    valid = groups !== nothing &&
+            all(groups) do (old_elements, new_elements)
+                (length(old_elements) == 1 && length(new_elements) in (1, n_children)) ||
+                    (length(old_elements) == n_children && length(new_elements) == 1)
+            end
+    if allreduce(valid ? 0 : 1, max) > 0
+        error("registry fields cannot be transferred to the new mesh")
+    end
+
+    for (old_elements, new_elements) in groups
+        for (index, new_field) in new_fields
+            old_field = old_fields[index]
+            if length(old_elements) == length(new_elements)
+                # unchanged element
+                old_element = first(old_elements)
+                new_element = first(new_elements)
+                for node_ci in node_cis, v in axes(new_field, 1)
+                    new_field[v, node_ci, new_element] = old_field[v, node_ci, old_element]
+                end
+            elseif length(old_elements) == 1
+                # refined element
+                for (child, new_element) in enumerate(new_elements)
+                    operators = ntuple(n_dims) do d
+                        isodd((child - 1) >> (d - 1)) ? adaptor.forward_upper :
+                        adaptor.forward_lower
+                    end
+                    add_tensor_product!(new_field, new_element, operators, old_field,
+                                        first(old_elements), node_cis)
+                end
+            else
+                # coarsened elements
+                for (child, old_element) in enumerate(old_elements)
+                    operators = ntuple(n_dims) do d
+                        isodd((child - 1) >> (d - 1)) ? adaptor.reverse_upper :
+                        adaptor.reverse_lower
+                    end
+                    add_tensor_product!(new_field, first(new_elements), operators,
+                                        old_field, old_element, node_cis)
+                end
+            end
+        end
+    end
+
+    for (index, data) in new_data
+        simstate.registry[index] = data
+    end
+    save_registry_mesh!(simstate)
+
+    return nothing
+end
@@ -0,0 +1,105 @@
+# Fast restart files, see `trixi_write_restart`
+#
+# A restart file contains the local part of the solution of one MPI rank. It consists of a
+# header of `RESTART_HEADER_SIZE` bytes (magic bytes, followed by a `RestartHeader` and
+# zero padding) and the raw contents of `integrator.u` in Trixi.jl's native memory layout
+# and byte order. The padding ensures that the payload is suitably aligned for mapping it
+# into memory.
+
+const RESTART_MAGIC = b"LTRIXIRS"
+const RESTART_VERSION = 1
+const RESTART_HEADER_SIZE = 128
+
+struct RestartHeader
+    version::Int64
+    mpi_rank::Int64
+    mpi_nranks::Int64
+    ndims::Int64
+    nvariables::Int64
+    nnodes::Int64
+    nelements::Int64
+    nelementsglobal::Int64
+    length_u::Int64
+    iter::Int64
+    t::Float64
+    dt::Float64
+end
+
+function RestartHeader(simstate)
+    mesh, equations, solver, cache = mesh_equations_solver_cache(simstate.semi)
+    integrator = simstate.integrator
+
+    return RestartHeader(RESTART_VERSION, Trixi.mpi_rank(), Trixi.mpi_nranks(),
+                         ndims(mesh), nvariables(equations), nnodes(solver),
+                         nelements(solver, cache), nelementsglobal(mesh, solver, cache),
+                         length(integrator.u), integrator.stats.naccept, integrator.t,
+                         integrator.dtpropose)
+end
+
+# Each MPI rank writes its own file, thus the rank is appended in parallel simulations
+function restart_filename(filename)
+    if Trixi.mpi_isparallel()
+        return string(filename, "_", lpad(Trixi.mpi_rank(), 6, '0'))
+    else
+        return filename
+    end
+end
+
+function write_restart(simstate, filename)
+    filename = restart_filename(filename)
+    header = RestartHeader(simstate)
+
+    # Write to temporary file first to never leave a corrupted restart file behind
+    tmp_filename = filename * ".tmp"
+    open(tmp_filename, "w") do io
+        write(io, RESTART_MAGIC)
+        write(io, Ref(header))
+        write(io, zeros(UInt8, RESTART_HEADER_SIZE - position(io)))
+        write(io, simstate.integrator.u)
+    end
+    mv(tmp_filename, filename, force = true)
+
+    return nothing
+end
+
+function load_restart!(simstate, filename)
+    filename = restart_filename(filename)
+    integrator = simstate.integrator
+
+    open(filename, "r") do io
+        # Verify that the file matches the current simulation, including its partitioning
+        if read(io, length(RESTART_MAGIC)) != RESTART_MAGIC
+            error("not a libtrixi restart file: ", filename)
+        end
+        header = read!(io, Ref{RestartHeader}())[]
+        expected = RestartHeader(simstate)
+        if header.version != RESTART_VERSION
+            error("unsupported restart file version ", header.version, " (expected ",
+                  RESTART_VERSION, ")")
+        end
+        for name in (:mpi_rank, :mpi_nranks, :ndims, :nvariables, :nnodes, :nelements,
+                     :nelementsglobal, :length_u)
+            if getfield(header, name) != getfield(expected, name)
+                error("restart file does not match simulation: ", name, " is ",
+                      getfield(header, name), " (expected ", getfield(expected, name), ")")
+            end
+        end
+
+        # Map the payload into memory and copy it into the solution in a single pass, while
+        # also resetting time and callbacks to the restart time
+        u = Mmap.mmap(io, Vector{Float64}, (header.length_u,), RESTART_HEADER_SIZE)
+        tf = integrator.sol.prob.tspan[2]
+        reinit!(integrator, u; t0 = header.t, tf = tf, erase_sol = true,
+                reset_dt = false)
+        finalize(u)
+
+        # Restore step counter and time step
+        integrator.iter = header.iter
+        integrator.stats.naccept = header.iter
+        if header.dt > 0
+            set_proposed_dt!(integrator, header.dt)
+        end
+    end
+
+    return nothing
+end
@@ -1,5 +1,84 @@
 const LibTrixiDataRegistry = Vector{Vector{Float64}}
 
+"""
+    AsyncCheckpoint
+
+State of the asynchronous checkpoint writer of a simulation, see
+[`trixi_checkpoint_async`](@ref).
+"""
+mutable struct AsyncCheckpoint
+    # Staging copy of the solution that is written in the background
+    u::Vector{Float64}
+    # Task writing the pending checkpoint, `nothing` if there is none
+    task::Union{Task, Nothing}
+    # Whether time steps need to wait for a pending checkpoint, since they might modify
+    # data that is still required for writing (e.g., the mesh with AMR)
+    blocks_step::Bool
+
+    AsyncCheckpoint() = new(Float64[], nothing, false)
+end
+
+"""
+    MeshTracker
+
+Detection of mesh changes (e.g., due to AMR) of a simulation, see
+[`trixi_mesh_epoch`](@ref).
+"""
+mutable struct MeshTracker
+    # Number of detected mesh changes since initialization
+    epoch::Int
+    # Node coordinates of the current mesh, the array is replaced whenever Trixi.jl resizes
+    # the element container
+    node_coordinates::AbstractArray{Float64}
+    # Number of local elements of the current mesh
+    nelements::Int
+    # C function notified after mesh changes, `C_NULL` if none is registered
+    callback::Ptr{Cvoid}
+    userdata::Ptr{Cvoid}
+    # Global index offset of the local elements and the epoch it was computed for (-1 if
+    # not computed yet)
+    element_global_offset::Int
+    element_global_offset_epoch::Int
+end
+
+function MeshTracker(semi)
+    _, _, solver, cache = mesh_equations_solver_cache(semi)
+    return MeshTracker(0, cache.elements.node_coordinates, nelements(solver, cache), C_NULL,
+                       C_NULL, 0, -1)
+end
+
+"""
+    RegistryFields
+
+Registry fields allocated by libtrixi, which are transferred to the new mesh whenever the
+mesh changes, see [`trixi_registry_alloc`](@ref).
+"""
+mutable struct RegistryFields
+    # Number of components of each field, by registry index
+    ncomponents::Dict{Int, Int}
+    # Element volumes of the mesh the fields are defined on
+    volumes::Vector{Float64}
+
+    RegistryFields() = new(Dict{Int, Int}(), Float64[])
+end
+
+"""
+    Probe
+
+Set of points at which the solution can be evaluated repeatedly, see
+[`trixi_probe_create`](@ref).
+"""
+struct Probe
+    # Local element containing each point, zero if not found on this rank
+    elements::Vector{Int}
+    # Lagrange interpolation weights of each point in each direction (nnodes, ndims, npoints)
+    interpolation_weights::Array{Float64, 3}
+    # Rank evaluating each point, -1 for points outside of the domain
+    owners::Vector{Int}
+    # Mesh epoch when the probe was created
+    mesh_epoch::Int
+end
+
 """
     SimulationState
 
@@ -7,65 +86,156 @@ Data structure to store a simulation state consisting of
 - a semidiscretization
 - the time integrator
 - an optional array of data vectors
+- the state of the asynchronous checkpoint writer
+- the probes created for this simulation (`nothing` for freed probes)
+- the detection of mesh changes
+- the registry fields allocated by libtrixi
 """
 mutable struct SimulationState{SemiType, IntegratorType}
     semi::SemiType
     integrator::IntegratorType
     registry::LibTrixiDataRegistry
+    checkpoint::AsyncCheckpoint
+    probes::Vector{Union{Probe, Nothing}}
+    mesh_tracker::MeshTracker
+    registry_fields::RegistryFields
 
     function SimulationState(semi, integrator, registry = LibTrixiDataRegistry())
-        return new{typeof(semi), typeof(integrator)}(semi, integrator, registry)
+        return new{typeof(semi), typeof(integrator)}(semi, integrator, registry,
+                                                     AsyncCheckpoint(),
+                                                     Union{Probe, Nothing}[],
+                                                     MeshTracker(semi), RegistryFields())
     end
 end
 
+"""
+    StateLayout
+
+C-compatible description of the memory layout of the internal state array `u`, see
+[`trixi_get_state_layout`](@ref). Must match `trixi_state_layout_t` in `trixi.h`.
+"""
+struct StateLayout
+    data::Ptr{Cdouble}
+    version::Cint
+    ndims::Cint
+    nnodes::Cint
+    nvariables::Cint
+    ndofselement::Cint
+    nelements::Cint
+    variable_stride::Cint
+    node_stride::Cint
+    element_stride::Cint
+end
+
+# Version of the state layout description, must match `TRIXI_STATE_LAYOUT_VERSION`
+const STATE_LAYOUT_VERSION = 1
+
 # Global variables to store different simulation states
 # This allows one to handle multiple Trixi.jl simulations independently
 #
 # Opaque handle type that can be passed to and stored in the C program
 const SimulationStateHandle = Cint
-# Variable that internally holds different simulation states such that they are not garbage
-# collected prematurely
-const simstates = Dict{SimulationStateHandle, SimulationState}()
-# Number of simulation states already created
-const simstate_counter = Ref(0)
 
-# Take the simulation state and store it in the global simstate dict to prevent garbage
-# collection, then return a C-compatible handle to it
-function store_simstate(simstate)
-    if simstate_counter[] >= typemax(SimulationStateHandle)
-        error("maximum number of storable simulation states reached: ",
-              typemax(SimulationStateHandle))
-    end
+# A handle consists of the (one-based) index of a slot in the simulation state table in the
+# lower bits and the generation of that slot in the upper bits. Since the generation is
+# incremented whenever a slot is freed, handles of finalized simulations are detected as
+# invalid even after their slot has been reused (until the generation wraps around).
+const SIMSTATE_SLOT_BITS = 20
+const SIMSTATE_SLOT_MASK = (1 << SIMSTATE_SLOT_BITS) - 1
+const SIMSTATE_GENERATION_MASK = typemax(SimulationStateHandle) >> SIMSTATE_SLOT_BITS
 
-    simstate_counter[] += 1
-    handle = simstate_counter[]
-    if in(handle, keys(simstates))
-        error("simstate handle already exists - this should not be possible...")
-    end
+# Slot array to hold different simulation states such that they are not garbage collected
+# prematurely, with O(1) lookup and reuse of freed slots
+struct SimulationStateTable
+    # Stored simulation states, `nothing` for free slots
+    states::Vector{Union{SimulationState, Nothing}}
+    # Current generation of each slot
+    generations::Vector{Int}
+    # Indices of free slots, reused in LIFO order
+    free_slots::Vector{Int}
+end
+
+function SimulationStateTable()
+    return SimulationStateTable(Union{SimulationState, Nothing}[], Int[], Int[])
+end
 
-    simstates[handle] = simstate
+# Variable that internally holds different simulation states
+const simstates = SimulationStateTable()
+# Lock to protect `simstates`, since different simulation states may be accessed
+# concurrently from different (possibly foreign) threads
+const simstates_lock = ReentrantLock()
+# Lock to serialize loading libelixirs, since each of them (re)defines `Main.init_simstate`
+const libelixir_lock = ReentrantLock()
 
-    return handle
+# Convert between handles and slot index/generation
+@inline function encode_handle(slot, generation)
+    return SimulationStateHandle((generation << SIMSTATE_SLOT_BITS) | slot)
 end
+@inline decode_handle(handle) = (Int(handle & SIMSTATE_SLOT_MASK),
+                                 Int(handle >> SIMSTATE_SLOT_BITS))
 
-# Load the simulation state identified by the handle from the global simstate dict
-function load_simstate(handle)
-    if !in(handle, keys(simstates))
-        error("the provided handle was not found in the stored simulation states: ", handle)
+# Return slot index for a handle or zero if the handle does not refer to a stored simstate
+@inline function find_slot(table, handle)
+    slot, generation = decode_handle(handle)
+    if handle <= 0 || slot < 1 || slot > length(table.states) ||
+       table.generations[slot] != generation || isnothing(table.states[slot])
+        return 0
     end
 
-    simstate = simstates[handle]
+    return slot
+end
 
-    return simstate
+# Take the simulation state and store it in the global simstate table to prevent garbage
+# collection, then return a C-compatible handle to it
+function store_simstate(simstate)
+    lock(simstates_lock) do
+        if !isempty(simstates.free_slots)
+            # Reuse most recently freed slot
+            slot = pop!(simstates.free_slots)
+            simstates.states[slot] = simstate
+        else
+            if length(simstates.states) >= SIMSTATE_SLOT_MASK
+                error("maximum number of simultaneously stored simulation states reached: ",
+                      SIMSTATE_SLOT_MASK)
+            end
+
+            push!(simstates.states, simstate)
+            push!(simstates.generations, 0)
+            slot = length(simstates.states)
+        end
+
+        return encode_handle(slot, simstates.generations[slot])
+    end
 end
 
-# Remove the simulation state identified by the handle from the global simstate dict
-function delete_simstate!(handle)
-    if !in(handle, keys(simstates))
-        error("the provided handle was not found in the stored simulation states: ", handle)
+# Load the simulation state identified by the handle from the global simstate table
+function load_simstate(handle)
+    lock(simstates_lock) do
+        slot = find_slot(simstates, handle)
+        if slot == 0
+            error("the provided handle was not found in the stored simulation states: ",
+                  handle)
+        end
+
+        return simstates.states[slot]
     end
+end
 
-    delete!(simstates, handle)
+# Remove the simulation state identified by the handle from the global simstate table and
+# free its slot for reuse
+function delete_simstate!(handle)
+    lock(simstates_lock) do
+        slot = find_slot(simstates, handle)
+        if slot == 0
+            error("the provided handle was not found in the stored simulation states: ",
+                  handle)
+        end
+
+        simstates.states[slot] = nothing
+        simstates.generations[slot] = (simstates.generations[slot] + 1) &
+                                      SIMSTATE_GENERATION_MASK
+        push!(simstates.free_slots, slot)
 
-    return handle
+        return handle
+    end
 end
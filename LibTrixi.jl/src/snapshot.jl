@@ -0,0 +1,146 @@
+# In-memory snapshots of the time integration state, see `trixi_save_state`
+#
+# A snapshot is a flat array of `Float64` values consisting of a header followed by the
+# contents of all arrays that make up the state of the time integrator, each of length
+# `length(integrator.u)`. The header contains
+#   1. the snapshot format version
+#   2. the length of each array
+#   3. the number of arrays
+#   4. to 12. the scalar integrator fields in `SNAPSHOT_SCALAR_FIELDS`
+
+# Version of the snapshot format, incremented on incompatible changes
+const SNAPSHOT_VERSION = 2
+
+# Scalar fields of the integrator to save and restore (if present), given as paths of
+# property names relative to the integrator
+const SNAPSHOT_SCALAR_FIELDS = ((:t,), (:tprev,), (:dt,), (:dtpropose,), (:iter,), (:qold,),
+                                (:EEst,), (:stats, :naccept), (:stats, :nreject))
+
+const SNAPSHOT_HEADER_SIZE = 3 + length(SNAPSHOT_SCALAR_FIELDS)
+
+# Collect all arrays that hold the current state of the time integrator, i.e., the solution
+# itself as well as all registers of the time integration method with the same size (e.g.,
+# stage registers of low-storage Runge-Kutta methods or FSAL values)
+function snapshot_arrays(integrator)
+    u = integrator.u
+    arrays = [u]
+
+    candidates = Any[integrator.uprev]
+    for name in (:fsalfirst, :fsallast)
+        if hasproperty(integrator, name)
+            push!(candidates, getproperty(integrator, name))
+        end
+    end
+    for name in fieldnames(typeof(integrator.cache))
+        if isdefined(integrator.cache, name)
+            push!(candidates, getfield(integrator.cache, name))
+        end
+    end
+
+    for candidate in candidates
+        # Only consider arrays compatible with `u` and skip arrays aliasing each other
+        if candidate isa typeof(u) && length(candidate) == length(u) &&
+           !any(array -> array === candidate, arrays)
+            push!(arrays, candidate)
+        end
+    end
+
+    return arrays
+end
+
+# Return the object holding the last property of `path`, or `nothing` if it does not exist
+function scalar_field_owner(integrator, path)
+    owner = integrator
+    for name in path[1:(end - 1)]
+        if !hasproperty(owner, name)
+            return nothing
+        end
+        owner = getproperty(owner, name)
+    end
+
+    return owner
+end
+
+# Return true if the integrator has a real-valued scalar field at `path`
+function has_scalar_field(integrator, path)
+    owner = scalar_field_owner(integrator, path)
+    return owner !== nothing && hasproperty(owner, last(path)) &&
+           getproperty(owner, last(path)) isa Real
+end
+
+get_scalar_field(integrator, path) =
+    getproperty(scalar_field_owner(integrator, path), last(path))
+
+# Set scalar field at `path`, fields derived from others (e.g., `stats` of Trixi's own time
+# integrators) are immutable and skipped
+function set_scalar_field!(integrator, path, value)
+    owner = scalar_field_owner(integrator, path)
+    if ismutable(owner)
+        name = last(path)
+        setproperty!(owner, name, convert(typeof(getproperty(owner, name)), value))
+    end
+
+    return nothing
+end
+
+function snapshot_size(integrator)
+    return SNAPSHOT_HEADER_SIZE + length(integrator.u) * length(snapshot_arrays(integrator))
+end
+
+function save_snapshot!(buffer, integrator)
+    arrays = snapshot_arrays(integrator)
+    n = length(integrator.u)
+    if length(buffer) < SNAPSHOT_HEADER_SIZE + n * length(arrays)
+        error("buffer too small for snapshot: ", length(buffer), " < ",
+              SNAPSHOT_HEADER_SIZE + n * length(arrays))
+    end
+
+    # Header
+    buffer[1] = SNAPSHOT_VERSION
+    buffer[2] = n
+    buffer[3] = length(arrays)
+    for (i, path) in enumerate(SNAPSHOT_SCALAR_FIELDS)
+        value = has_scalar_field(integrator, path) ? get_scalar_field(integrator, path) : 0
+        buffer[3 + i] = value
+    end
+
+    # Arrays
+    offset = SNAPSHOT_HEADER_SIZE
+    for array in arrays
+        copyto!(buffer, offset + 1, array, 1, n)
+        offset += n
+    end
+
+    return nothing
+end
+
+function restore_snapshot!(integrator, buffer)
+    arrays = snapshot_arrays(integrator)
+    n = length(integrator.u)
+
+    # Verify that the snapshot matches the current integrator
+    if length(buffer) < SNAPSHOT_HEADER_SIZE || buffer[1] != SNAPSHOT_VERSION
+        error("buffer does not contain a valid snapshot (version ", SNAPSHOT_VERSION, ")")
+    end
+    if buffer[2] != n || buffer[3] != length(arrays)
+        error("snapshot does not match simulation: expected ", length(arrays),
+              " arrays of length ", n, ", got ", buffer[3], " arrays of length ",
+              buffer[2])
+    end
+
+    # Header
+    for (i, path) in enumerate(SNAPSHOT_SCALAR_FIELDS)
+        if has_scalar_field(integrator, path)
+            set_scalar_field!(integrator, path, buffer[3 + i])
+        end
+    end
+
+    # Arrays
+    offset = SNAPSHOT_HEADER_SIZE
+    for array in arrays
+        copyto!(array, 1, buffer, offset + 1, n)
+        offset += n
+    end
+
+    return nothing
+end
@@ -0,0 +1,45 @@
+"""
+    LibTrixiSourceTerms()
+
+Source terms that are evaluated by a C function registered via
+[`trixi_register_source_terms`](@ref). Pass an instance as `source_terms` to the
+semidiscretization in `init_simstate()` of the libelixir.
+
+The registered function is called from within Trixi.jl's right-hand side evaluation, i.e.,
+in every Runge-Kutta stage and with the corresponding stage time. It receives direct
+pointers to the internal arrays `u` and `du` and to the physical node coordinates. As long
+as no function is registered, no source terms are applied.
+"""
+mutable struct LibTrixiSourceTerms
+    callback::Ptr{Cvoid}
+    userdata::Ptr{Cvoid}
+
+    LibTrixiSourceTerms() = new(C_NULL, C_NULL)
+end
+
+function calc_sources_libtrixi!(du, u, t, source_terms::LibTrixiSourceTerms, dg, cache)
+    if source_terms.callback == C_NULL
+        return nothing
+    end
+
+    # Pass raw pointers to `u`, `du`, and the node coordinates, which all share the same
+    # ordering of nodes and elements (see `trixi_get_state_layout`)
+    node_coordinates = cache.elements.node_coordinates
+    GC.@preserve u du node_coordinates begin
+        ccall(source_terms.callback, Cvoid,
+              (Cdouble, Ptr{Cdouble}, Ptr{Cdouble}, Ptr{Cdouble}, Cint, Ptr{Cvoid}),
+              t, pointer(u), pointer(du), pointer(node_coordinates),
+              nelements(dg, cache), source_terms.userdata)
+    end
+
+    return nothing
+end
+
+# Hook into Trixi.jl's right-hand side evaluation. One method per dimension is required to
+# avoid ambiguities with the methods defined in Trixi.jl
+for NDIMS in 1:3
+    @eval function Trixi.calc_sources!(du, u, t, source_terms::LibTrixiSourceTerms,
+                                       equations::AbstractEquations{$NDIMS}, dg::DG, cache)
+        calc_sources_libtrixi!(du, u, t, source_terms, dg, cache)
+    end
+end
@@ -2,6 +2,8 @@ module TestInterface
 
 using Test
 using LibTrixi
+import Trixi
+import OrdinaryDiffEqLowStorageRK
 
 
 @testset verbose=true showtiming=true "Version information" begin
@@ -16,6 +18,13 @@ using LibTrixi
     @test occursin("StartUpDG", unsafe_string(trixi_version_julia_extended()))
 end
 
+
+@testset verbose=true showtiming=true "Threading" begin
+    @test trixi_nthreads() == Threads.nthreads()
+    @test trixi_nthreads() >= 1
+end
+
+
 @testset verbose=true showtiming=true "Evaluate string as code (trixi_eval_string)" begin
     # We can't really do much more than a smoke test, since the C API does not return
     # anything useful
@@ -36,13 +45,27 @@ simstate_jl = trixi_initialize_simulation_jl(libelixir)
 @testset verbose=true showtiming=true "Simulation handle" begin
 
     # one handle was created
-    @test LibTrixi.simstate_counter[] == handle == 1
+    @test handle == 1
 
     # simstates are not the same
-    @test LibTrixi.simstates[handle] != simstate_jl
+    @test load_simstate(handle) != simstate_jl
 
     # using a non-existent handle
     @test_throws ErrorException trixi_is_finished(Int32(42))
+    @test_throws ErrorException trixi_is_finished(Int32(0))
+    @test_throws ErrorException trixi_is_finished(Int32(-1))
+
+    # freed slots are reused, but with a new handle
+    handle_tmp = store_simstate(simstate_jl)
+    @test handle_tmp == 2
+    delete_simstate!(handle_tmp)
+    handle_reused = store_simstate(simstate_jl)
+    @test handle_reused != handle_tmp
+    @test handle_reused & LibTrixi.SIMSTATE_SLOT_MASK == 2
+    @test_throws ErrorException load_simstate(handle_tmp)
+    @test load_simstate(handle_reused) === simstate_jl
+    delete_simstate!(handle_reused)
+    @test_throws ErrorException delete_simstate!(handle_reused)
 end
 
 
@@ -68,16 +91,120 @@ end
     @test trixi_is_finished(handle) == 0
     @test !trixi_is_finished_jl(simstate_jl)
 
+    # do multiple steps via API and via julia
+    time_c = zeros(1)
+    @test trixi_step_n(handle, Int32(3), pointer(time_c)) == 3
+    @test trixi_step_n_jl(simstate_jl, 3) == 3
+    @test time_c[1] == trixi_get_simulation_time_jl(simstate_jl)
+
+    # advance to a given time via API and via julia
+    target_time = time_c[1] + 0.05
+    nsteps_c = trixi_advance_to_time(handle, target_time, pointer(time_c))
+    nsteps_jl = trixi_advance_to_time_jl(simstate_jl, target_time)
+    @test nsteps_c == nsteps_jl > 0
+    @test time_c[1] == target_time
+    @test trixi_get_simulation_time_jl(simstate_jl) == target_time
+
+    # mesh is static, no mesh changes are reported
+    @test trixi_mesh_epoch(handle) == 0
+    @test trixi_mesh_epoch_jl(simstate_jl) == 0
+    @test !LibTrixi.check_mesh_change!(simstate_jl)
+
+    # save snapshot via API and via julia
+    snapshot_size = trixi_save_state_size(handle)
+    @test snapshot_size == trixi_save_state_size_jl(simstate_jl)
+    snapshot_c = zeros(snapshot_size)
+    snapshot_jl = zeros(snapshot_size)
+    trixi_save_state(handle, pointer(snapshot_c))
+    trixi_save_state_jl(simstate_jl, snapshot_jl)
+    @test snapshot_c == snapshot_jl
+
+    # steps after restoring a snapshot are identical to the original ones
+    naccept_snapshot = load_simstate(handle).integrator.stats.naccept
+    trixi_step_n(handle, Int32(2), Ptr{Cdouble}(C_NULL))
+    u_original = copy(load_simstate(handle).integrator.u)
+    time_original = trixi_get_simulation_time(handle)
+    trixi_restore_state(handle, pointer(snapshot_c))
+    @test trixi_get_simulation_time(handle) == target_time
+    @test load_simstate(handle).integrator.stats.naccept == naccept_snapshot
+    trixi_step_n(handle, Int32(2), Ptr{Cdouble}(C_NULL))
+    @test load_simstate(handle).integrator.u == u_original
+    @test trixi_get_simulation_time(handle) == time_original
+
+    # roll back again to stay in sync with julia simulation
+    trixi_restore_state(handle, pointer(snapshot_c))
+    @test trixi_get_simulation_time(handle) == target_time
+
+    # invalid snapshots are rejected
+    @test_throws ErrorException trixi_restore_state_jl(simstate_jl, zeros(snapshot_size))
+
+    # write checkpoint in the background, file name is based on current step
+    iter = load_simstate(handle).integrator.stats.naccept
+    output_directory = LibTrixi.find_save_solution_callback(
+        load_simstate(handle).integrator).output_directory
+    checkpoint_file = joinpath(output_directory,
+                               "solution_" * lpad(iter, 9, '0') * ".h5")
+    rm(checkpoint_file, force = true)
+    trixi_checkpoint_async(handle)
+    trixi_checkpoint_wait(handle)
+    @test isfile(checkpoint_file)
+    # waiting without pending checkpoint returns immediately
+    trixi_checkpoint_wait(handle)
+
+    # write restart file via API and via julia, continue from it in new simulations
+    restart_file_c = tempname()
+    restart_file_jl = tempname()
+    trixi_write_restart(handle, restart_file_c)
+    trixi_write_restart_jl(simstate_jl, restart_file_jl)
+    @test read(restart_file_c) == read(restart_file_jl)
+    handle_restart = trixi_initialize_simulation_from_restart(libelixir, restart_file_c)
+    simstate_restart = load_simstate(handle_restart)
+    @test simstate_restart.integrator.u == load_simstate(handle).integrator.u
+    @test trixi_get_simulation_time(handle_restart) == trixi_get_simulation_time(handle)
+    @test simstate_restart.integrator.stats.naccept ==
+        load_simstate(handle).integrator.stats.naccept
+    # steps after restarting are identical to the original ones
+    trixi_step(handle_restart)
+    simstate_tmp = trixi_initialize_simulation_from_restart_jl(libelixir, restart_file_jl)
+    trixi_step_jl(simstate_tmp)
+    @test simstate_restart.integrator.u == simstate_tmp.integrator.u
+    trixi_finalize_simulation_jl(simstate_tmp)
+    trixi_finalize_simulation(handle_restart)
+    # restart files not matching the simulation are rejected
+    write(restart_file_jl, zeros(UInt8, 256))
+    @test_throws ErrorException trixi_initialize_simulation_from_restart_jl(libelixir,
+                                                                            restart_file_jl)
+    rm(restart_file_c)
+    rm(restart_file_jl)
+
     # manually increase registries (for testing only!)
     push!(simstate_jl.registry, Vector{Float64}())
-    push!(LibTrixi.simstates[handle].registry, Vector{Float64}())
+    push!(load_simstate(handle).registry, Vector{Float64}())
     # store a vector
     test_data = [1.0, 2.0, 3.0]
     trixi_register_data(handle, Int32(1), Int32(3), pointer(test_data))
     trixi_register_data_jl(simstate_jl, 1, test_data)
     # check that the same memory is referenced
     @test pointer(simstate_jl.registry[1]) ==
-        pointer(LibTrixi.simstates[handle].registry[1])
+        pointer(load_simstate(handle).registry[1])
+
+    # allocate a field in the registry
+    field_c = trixi_registry_alloc(handle, Int32(1), Int32(2))
+    field_jl = trixi_registry_alloc_jl(simstate_jl, 1, 2)
+    @test length(simstate_jl.registry[1]) == 2 * trixi_ndofs_jl(simstate_jl)
+    @test all(iszero, simstate_jl.registry[1])
+    @test trixi_registry_get_pointer(handle, Int32(1)) == field_c
+    @test trixi_registry_get_pointer_jl(simstate_jl, 1) == field_jl
+    @test_throws ErrorException trixi_registry_alloc_jl(simstate_jl, 2, 1)
+    @test_throws ErrorException trixi_registry_alloc_jl(simstate_jl, 1, 0)
+    # fields registered by the user are not managed
+    trixi_register_data_jl(simstate_jl, 1, test_data)
+    @test_throws ErrorException trixi_registry_get_pointer_jl(simstate_jl, 1)
+
+    # elements are matched by volume: unchanged, refined, coarsened
+    @test LibTrixi.match_elements([1.0, 1.0, 0.5, 0.5], [1.0, 0.5, 0.5, 1.0]) ==
+        [(1:1, 1:1), (2:2, 2:3), (3:4, 4:4)]
+    @test LibTrixi.match_elements([1.0, 1.0], [1.0, 0.5]) === nothing
 end
 
 
@@ -97,6 +224,15 @@ end
     nelementsglobal_jl = trixi_nelementsglobal_jl(simstate_jl)
     @test nelementsglobal_c == nelementsglobal_jl
 
+    # rebalancing is not available for TreeMesh
+    weights = ones(nelements_c)
+    @test_throws ErrorException trixi_rebalance(handle, pointer(weights))
+    @test_throws ErrorException trixi_rebalance_jl(simstate_jl, weights)
+
+    # compare global element offset
+    @test trixi_element_global_offset(handle) == 0
+    @test trixi_element_global_offset_jl(simstate_jl) == 0
+
     # compare number of dofs
     ndofs_c = trixi_ndofs(handle)
     ndofs_jl = trixi_ndofs_jl(simstate_jl)
@@ -134,6 +270,16 @@ end
     trixi_load_node_weights_jl(simstate_jl, data_jl)
     @test data_c == data_jl
 
+    # compare physical coordinates of quadrature nodes
+    data_c = zeros(ndims_c * ndofs_c)
+    trixi_load_node_coordinates(handle, pointer(data_c))
+    data_jl = zeros(ndims_jl * ndofs_jl)
+    trixi_load_node_coordinates_jl(simstate_jl, data_jl)
+    @test data_c == data_jl
+    @test all(-1.0 .<= data_c .<= 1.0)
+    data_ptr_c = trixi_get_node_coordinates_pointer(handle)
+    @test unsafe_wrap(Array, data_ptr_c, ndims_c * ndofs_c) == data_c
+
     # compare element averaged values
     data_c = zeros(nelements_c)
     trixi_load_element_averaged_primitive_var(handle, Int32(1), pointer(data_c))
@@ -148,6 +294,19 @@ end
     trixi_load_conservative_var_jl(simstate_jl, 1, data_jl)
     @test data_c == data_jl
 
+    # compare multiple conservative variable values on all dofs
+    data_c = [zeros(ndofs_c) for _ in 1:nvariables_c]
+    data_ptrs_c = pointer.(data_c)
+    variable_ids_c = Int32.(collect(nvariables_c:-1:1))
+    trixi_load_conservative_vars(handle, nvariables_c, pointer(variable_ids_c),
+                                 pointer(data_ptrs_c))
+    data_jl = [zeros(ndofs_jl) for _ in 1:nvariables_jl]
+    trixi_load_conservative_vars_jl(simstate_jl, nvariables_jl:-1:1, data_jl)
+    @test data_c == data_jl
+    data_single_jl = zeros(ndofs_jl)
+    trixi_load_conservative_var_jl(simstate_jl, nvariables_jl, data_single_jl)
+    @test data_jl[1] == data_single_jl
+
     # compare primitive variable values on all dofs
     data_c = zeros(ndofs_c)
     trixi_load_primitive_var(handle, Int32(1), pointer(data_c))
@@ -155,6 +314,102 @@ end
     trixi_load_primitive_var_jl(simstate_jl, 1, data_jl)
     @test data_c == data_jl
 
+    # compare multiple primitive variable values on all dofs
+    data_c = [zeros(ndofs_c) for _ in 1:nvariables_c]
+    data_ptrs_c = pointer.(data_c)
+    variable_ids_c = Int32.(collect(1:nvariables_c))
+    trixi_load_primitive_vars(handle, nvariables_c, pointer(variable_ids_c),
+                              pointer(data_ptrs_c))
+    data_jl = [zeros(ndofs_jl) for _ in 1:nvariables_jl]
+    trixi_load_primitive_vars_jl(simstate_jl, 1:nvariables_jl, data_jl)
+    @test data_c == data_jl
+    data_single_jl = zeros(ndofs_jl)
+    trixi_load_primitive_var_jl(simstate_jl, 1, data_single_jl)
+    @test data_jl[1] == data_single_jl
+
+    # single precision variants return the rounded double precision values
+    data_c = zeros(Float32, ndofs_c)
+    trixi_load_conservative_var_float(handle, Int32(1), pointer(data_c))
+    data_jl = zeros(ndofs_jl)
+    trixi_load_conservative_var_jl(simstate_jl, 1, data_jl)
+    @test data_c == Float32.(data_jl)
+    trixi_load_primitive_var_float(handle, Int32(1), pointer(data_c))
+    trixi_load_primitive_var_jl(simstate_jl, 1, data_jl)
+    @test data_c == Float32.(data_jl)
+
+    data_c = [zeros(Float32, ndofs_c) for _ in 1:nvariables_c]
+    data_ptrs_c = pointer.(data_c)
+    variable_ids_c = Int32.(collect(1:nvariables_c))
+    data_jl = [zeros(ndofs_jl) for _ in 1:nvariables_jl]
+    trixi_load_conservative_vars_float(handle, nvariables_c, pointer(variable_ids_c),
+                                       pointer(data_ptrs_c))
+    trixi_load_conservative_vars_jl(simstate_jl, 1:nvariables_jl, data_jl)
+    @test data_c == [Float32.(data) for data in data_jl]
+    trixi_load_primitive_vars_float(handle, nvariables_c, pointer(variable_ids_c),
+                                    pointer(data_ptrs_c))
+    trixi_load_primitive_vars_jl(simstate_jl, 1:nvariables_jl, data_jl)
+    @test data_c == [Float32.(data) for data in data_jl]
+
+    data_c = zeros(Float32, nelements_c)
+    trixi_load_element_averaged_primitive_var_float(handle, Int32(1), pointer(data_c))
+    data_jl = zeros(nelements_jl)
+    trixi_load_element_averaged_primitive_var_jl(simstate_jl, 1, data_jl)
+    @test data_c == Float32.(data_jl)
+
+    # global reductions match Trixi.jl's integration and the loaded values
+    semi = load_simstate(handle).semi
+    u_ode = load_simstate(handle).integrator.u
+    integral = LibTrixi.Trixi.integrate((u, equations) -> u[1], u_ode, semi;
+                                        normalize = false)
+    @test trixi_integrate_var(handle, Int32(1)) ≈ integral
+    @test trixi_integrate_var_jl(simstate_jl, 1) ≈ integral
+    l2_c = zeros(1)
+    linf_c = zeros(1)
+    trixi_norm_var(handle, Int32(1), pointer(l2_c), pointer(linf_c))
+    l2_squared = LibTrixi.Trixi.integrate((u, equations) -> u[1]^2, u_ode, semi)
+    data_c = zeros(ndofs_c)
+    trixi_load_conservative_var(handle, Int32(1), pointer(data_c))
+    @test l2_c[1] ≈ sqrt(l2_squared)
+    @test linf_c[1] == maximum(abs, data_c)
+    @test trixi_norm_var_jl(simstate_jl, 1) == (l2_c[1], linf_c[1])
+    min_c = zeros(1)
+    max_c = zeros(1)
+    trixi_minmax_var(handle, Int32(1), pointer(min_c), pointer(max_c))
+    @test (min_c[1], max_c[1]) == extrema(data_c)
+    @test trixi_minmax_var_jl(simstate_jl, 1) == (min_c[1], max_c[1])
+    @test_throws ErrorException trixi_minmax_var_jl(simstate_jl, 2)
+
+    # probes at interior node positions reproduce the nodal values, points outside yield
+    # NaN
+    node_coordinates = zeros(ndofs_c)
+    trixi_load_node_coordinates(handle, pointer(node_coordinates))
+    interior_nodes = [2, 3, 6, 7]
+    points_c = [node_coordinates[interior_nodes]; 0.123; 5.0]
+    probe_c = trixi_probe_create(handle, Int32(length(points_c)), pointer(points_c))
+    @test probe_c == 1
+    probe_jl = trixi_probe_create_jl(simstate_jl, reshape(points_c, 1, :))
+    @test probe_jl == 1
+    variable_ids_c = Int32[1]
+    probe_data_c = zeros(length(points_c))
+    trixi_probe_eval(handle, probe_c, Int32(1), pointer(variable_ids_c),
+                     pointer(probe_data_c))
+    probe_data_jl = zeros(length(points_c), 1)
+    trixi_probe_eval_jl(simstate_jl, probe_jl, [1], probe_data_jl)
+    @test isequal(probe_data_c, vec(probe_data_jl))
+    @test probe_data_c[1:4] ≈ data_c[interior_nodes] atol=1e-13
+    @test min_c[1] <= probe_data_c[5] <= max_c[1]
+    @test isnan(probe_data_c[6])
+    @test_throws ErrorException trixi_probe_eval_jl(simstate_jl, 2, [1], probe_data_jl)
+
+    # freed probes are invalid and their indices are reused
+    trixi_probe_free(handle, probe_c)
+    @test_throws ErrorException trixi_probe_free(handle, probe_c)
+    @test trixi_probe_create(handle, Int32(length(points_c)), pointer(points_c)) == probe_c
+    trixi_probe_free(handle, probe_c)
+    trixi_probe_free_jl(simstate_jl, probe_jl)
+    @test_throws ErrorException trixi_probe_eval_jl(simstate_jl, probe_jl, [1],
+                                                    probe_data_jl)
+
     # write 1.0 to first variable and compare via raw access
     data_c = fill(1.0, ndofs_c)
     trixi_store_conservative_var(handle, Int32(1), pointer(data_c))
@@ -168,6 +423,72 @@ end
     data_ptr_jl = trixi_get_conservative_vars_pointer_jl(simstate_jl)
     data_jl = unsafe_wrap(Array, data_ptr_jl, ndofs_jl)
     @test all(data_jl .== 2.0)
+
+    # store and load a subset of elements, all other elements remain unchanged
+    elements_c = Int32[3, 1]
+    nsubset_c = Int32(length(elements_c))
+    subset_c = collect(1.0:(nsubset_c * ndofselement_c))
+    trixi_store_conservative_var_elements(handle, Int32(1), nsubset_c, pointer(elements_c),
+                                          pointer(subset_c))
+    data_c = zeros(ndofs_c)
+    trixi_load_conservative_var(handle, Int32(1), pointer(data_c))
+    data_c = reshape(data_c, ndofselement_c, nelements_c)
+    @test vec(data_c[:, elements_c]) == subset_c
+    @test all(data_c[:, [2; 4:nelements_c]] .== 1.0)
+    subset_load_c = zeros(length(subset_c))
+    trixi_load_conservative_var_elements(handle, Int32(1), nsubset_c, pointer(elements_c),
+                                         pointer(subset_load_c))
+    @test subset_load_c == subset_c
+    trixi_load_primitive_var_elements(handle, Int32(1), nsubset_c, pointer(elements_c),
+                                      pointer(subset_load_c))
+    @test subset_load_c == subset_c
+    subset_jl = zeros(ndofselement_jl)
+    trixi_load_conservative_var_elements_jl(simstate_jl, 1, [nelements_jl], subset_jl)
+    @test all(subset_jl .== 2.0)
+    @test_throws ErrorException trixi_load_conservative_var_elements_jl(simstate_jl, 1,
+        [nelements_jl + 1], subset_jl)
+
+    # compare state layout and use it to address the raw data
+    layout_c = Vector{StateLayout}(undef, 1)
+    trixi_get_state_layout(handle, pointer(layout_c))
+    layout_jl = trixi_get_state_layout_jl(simstate_jl)
+    @test layout_c[1].data == trixi_get_conservative_vars_pointer(handle)
+    @test layout_jl.data == trixi_get_conservative_vars_pointer_jl(simstate_jl)
+    @test layout_c[1].version == layout_jl.version == LibTrixi.STATE_LAYOUT_VERSION
+    @test layout_c[1].nvariables == nvariables_c
+    @test layout_c[1].nelements == nelements_c
+    @test layout_c[1].ndofselement == ndofselement_c
+    @test layout_c[1].element_stride * nelements_c == nvariables_c * ndofs_c
+    @test unsafe_load(layout_jl.data, 1 + (nelements_jl - 1) * layout_jl.element_stride) ==
+          2.0
+end
+
+
+@testset verbose=true showtiming=true "Reductions on 2D TreeMesh" begin
+
+    # TreeMesh only stores the inverse Jacobian of the 1D mapping
+    equations = Trixi.LinearScalarAdvectionEquation2D((1.0, 0.5))
+    solver = Trixi.DGSEM(polydeg = 3, surface_flux = Trixi.flux_lax_friedrichs)
+    mesh = Trixi.TreeMesh((-1.0, -1.0), (1.0, 1.0), initial_refinement_level = 2,
+                          n_cells_max = 10_000, periodicity = true)
+    semi = Trixi.SemidiscretizationHyperbolic(mesh, equations,
+                                              Trixi.initial_condition_convergence_test,
+                                              solver)
+    ode = Trixi.semidiscretize(semi, (0.0, 1.0))
+    integrator = OrdinaryDiffEqLowStorageRK.init(ode,
+        OrdinaryDiffEqLowStorageRK.CarpenterKennedy2N54(williamson_condition = false),
+        dt = 0.01, save_everystep = false)
+    simstate_tree2d = SimulationState(semi, integrator)
+    handle_tree2d = store_simstate(simstate_tree2d)
+
+    integral = Trixi.integrate((u, equations) -> u[1], integrator.u, semi;
+                               normalize = false)
+    @test trixi_integrate_var(handle_tree2d, Int32(1)) ≈ integral
+    @test trixi_integrate_var_jl(simstate_tree2d, 1) ≈ integral
+    l2_squared = Trixi.integrate((u, equations) -> u[1]^2, integrator.u, semi)
+    @test trixi_norm_var_jl(simstate_tree2d, 1)[1] ≈ sqrt(l2_squared)
+
+    delete_simstate!(handle_tree2d)
 end
 
 
@@ -186,4 +507,175 @@ end
     @test_throws ErrorException trixi_finalize_simulation(handle)
 end
 
+
+# Source term function adding a constant source of one, counts its calls in `userdata`
+function source_terms_constant(time::Cdouble, u::Ptr{Cdouble}, du::Ptr{Cdouble},
+                               node_coordinates::Ptr{Cdouble}, nelements::Cint,
+                               userdata::Ptr{Cvoid})::Cvoid
+    ncalls = Ptr{Cint}(userdata)
+    unsafe_store!(ncalls, unsafe_load(ncalls) + 1)
+
+    # 1D scalar equation with polynomial degree 3
+    du_jl = unsafe_wrap(Array, du, 4 * nelements)
+    du_jl .+= 1.0
+    return nothing
+end
+
+
+@testset verbose=true showtiming=true "Source terms" begin
+
+    libelixir_source_terms = joinpath(dirname(pathof(LibTrixi)),
+        "../examples/libelixir_tree1d_advection_source_terms.jl")
+    handle_source_terms = trixi_initialize_simulation(libelixir_source_terms)
+
+    # source terms cannot be registered if the libelixir does not support them
+    handle_basic = trixi_initialize_simulation(libelixir)
+    @test_throws ErrorException trixi_register_source_terms(handle_basic, C_NULL, C_NULL)
+    trixi_finalize_simulation(handle_basic)
+
+    # register source term function
+    ncalls = Cint[0]
+    source_terms_cfptr = @cfunction(source_terms_constant, Cvoid,
+        (Cdouble, Ptr{Cdouble}, Ptr{Cdouble}, Ptr{Cdouble}, Cint, Ptr{Cvoid}))
+    trixi_register_source_terms(handle_source_terms, source_terms_cfptr,
+                                Ptr{Cvoid}(pointer(ncalls)))
+
+    # one step of a five-stage method calls the source terms once per stage
+    trixi_step(handle_source_terms)
+    @test ncalls[1] == 5
+
+    # the mean value of the solution grows linearly with time
+    trixi_step_n(handle_source_terms, Int32(9), Ptr{Cdouble}(C_NULL))
+    ndofs = trixi_ndofs(handle_source_terms)
+    nnodes = trixi_nnodes(handle_source_terms)
+    u = zeros(ndofs)
+    weights = zeros(nnodes)
+    trixi_load_conservative_var(handle_source_terms, Int32(1), pointer(u))
+    trixi_load_node_weights(handle_source_terms, pointer(weights))
+    u_mean = sum(u .* repeat(weights, ndofs ÷ nnodes)) / (2 * (ndofs ÷ nnodes))
+    @test u_mean ≈ 1.0 + trixi_get_simulation_time(handle_source_terms)
+
+    # deactivate source terms again
+    trixi_register_source_terms(handle_source_terms, C_NULL, C_NULL)
+    trixi_step(handle_source_terms)
+    @test ncalls[1] == 50
+
+    trixi_finalize_simulation(handle_source_terms)
+end
+
+
+@testset verbose=true showtiming=true "Refinement indicator" begin
+
+    libelixir_amr = joinpath(dirname(pathof(LibTrixi)),
+        "../examples/libelixir_tree1d_advection_amr.jl")
+    handle_amr = trixi_initialize_simulation(libelixir_amr)
+
+    # indicator cannot be set if the libelixir does not support it
+    handle_basic = trixi_initialize_simulation(libelixir)
+    indicator = zeros(trixi_nelements(handle_basic))
+    @test_throws ErrorException trixi_set_refinement_indicator(handle_basic,
+                                                               pointer(indicator))
+    trixi_finalize_simulation(handle_basic)
+
+    # registry field holding the node coordinates, linear data is preserved exactly by
+    # the transfer to the new mesh
+    simstate_amr = load_simstate(handle_amr)
+    push!(simstate_amr.registry, Float64[])
+    field = trixi_registry_alloc_jl(simstate_amr, 1, 1)
+    trixi_load_node_coordinates(handle_amr, field)
+
+    # refine the left half of the domain
+    nelements = trixi_nelements(handle_amr)
+    indicator = zeros(nelements)
+    indicator[1:div(nelements, 2)] .= 1.0
+    trixi_set_refinement_indicator(handle_amr, pointer(indicator))
+    trixi_step(handle_amr)
+    @test trixi_nelements(handle_amr) == nelements + div(nelements, 2)
+    @test trixi_mesh_epoch(handle_amr) == 1
+    node_coordinates = zeros(trixi_ndofs(handle_amr))
+    trixi_load_node_coordinates(handle_amr, pointer(node_coordinates))
+    @test simstate_amr.registry[1] ≈ node_coordinates
+
+    # indicator has to be set again for the new mesh
+    refinement_indicator = LibTrixi.find_refinement_indicator(simstate_amr.integrator)
+    @test_throws ErrorException refinement_indicator(nothing, nothing, nothing,
+                                                     simstate_amr.semi.solver,
+                                                     simstate_amr.semi.cache)
+
+    # coarsen back to the initial mesh
+    indicator = zeros(trixi_nelements(handle_amr))
+    trixi_set_refinement_indicator_jl(simstate_amr, indicator)
+    trixi_step(handle_amr)
+    @test trixi_nelements(handle_amr) == nelements
+    @test trixi_mesh_epoch(handle_amr) == 2
+    node_coordinates = zeros(trixi_ndofs(handle_amr))
+    trixi_load_node_coordinates(handle_amr, pointer(node_coordinates))
+    @test simstate_amr.registry[1] ≈ node_coordinates
+
+    trixi_finalize_simulation(handle_amr)
+end
+
+
+@testset verbose=true showtiming=true "Boundary data" begin
+
+    libelixir_boundary = joinpath(dirname(pathof(LibTrixi)),
+        "../examples/libelixir_p4est2d_advection_boundary_data.jl")
+    handle_boundary = trixi_initialize_simulation(libelixir_boundary)
+    simstate_boundary = load_simstate(handle_boundary)
+    x_neg = "x_neg"
+    x_neg_c = Cstring(pointer(x_neg))
+
+    # 4x4 trees with periodic y-direction, i.e., four faces on each x-boundary
+    nfaces = trixi_nboundary_faces(handle_boundary, x_neg_c)
+    @test nfaces == 4
+    @test trixi_nboundary_faces_jl(simstate_boundary, "x_pos") == 4
+    nnodes = trixi_nnodes(handle_boundary)
+    nboundary_nodes = nnodes * nfaces
+
+    # faces belong to the elements at the left side of the domain
+    elements_c = zeros(Cint, nfaces)
+    elements_jl = zeros(Cint, nfaces)
+    trixi_load_boundary_face_elements(handle_boundary, x_neg_c, pointer(elements_c))
+    trixi_load_boundary_face_elements_jl(simstate_boundary, x_neg, elements_jl)
+    @test elements_c == elements_jl
+    @test allunique(elements_c)
+
+    coordinates_c = zeros(2 * nboundary_nodes)
+    coordinates_jl = zeros(2 * nboundary_nodes)
+    trixi_load_boundary_node_coordinates(handle_boundary, x_neg_c, pointer(coordinates_c))
+    trixi_load_boundary_node_coordinates_jl(simstate_boundary, x_neg, coordinates_jl)
+    @test coordinates_c == coordinates_jl
+    @test all(coordinates_c[1:2:end] .≈ -1.0)
+
+    data_c = zeros(nboundary_nodes)
+    data_jl = zeros(nboundary_nodes)
+    trixi_load_boundary_conservative_var(handle_boundary, x_neg_c, Int32(1),
+                                         pointer(data_c))
+    trixi_load_boundary_conservative_var_jl(simstate_boundary, x_neg, 1, data_jl)
+    @test data_c == data_jl
+    @test all(data_c .≈ 2.0)
+    trixi_load_boundary_primitive_var(handle_boundary, x_neg_c, Int32(1), pointer(data_c))
+    @test data_c == data_jl
+
+    # errors for unknown boundaries, other boundary conditions, and meshes without names
+    @test_throws ErrorException trixi_nboundary_faces_jl(simstate_boundary, "z_neg")
+    @test_throws ErrorException trixi_register_boundary_data_jl(simstate_boundary, "x_pos",
+                                                                zeros(nboundary_nodes))
+    @test_throws ErrorException trixi_register_boundary_data_jl(simstate_boundary, x_neg,
+                                                                zeros(1))
+    handle_basic = trixi_initialize_simulation(libelixir)
+    @test_throws ErrorException trixi_nboundary_faces_jl(load_simstate(handle_basic),
+                                                         x_neg)
+    trixi_finalize_simulation(handle_basic)
+
+    # inflow of a larger state increases the solution at the inflow boundary
+    boundary_data = fill(3.0, nboundary_nodes)
+    trixi_register_boundary_data(handle_boundary, x_neg_c, pointer(boundary_data))
+    trixi_step_n(handle_boundary, Int32(10), Ptr{Cdouble}(C_NULL))
+    trixi_load_boundary_conservative_var_jl(simstate_boundary, x_neg, 1, data_jl)
+    @test all(data_jl .> 2.0)
+
+    trixi_finalize_simulation(handle_boundary)
+end
+
 end # module
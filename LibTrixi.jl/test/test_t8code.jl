@@ -20,6 +20,34 @@ simstate_jl = trixi_initialize_simulation_jl(libelixir)
     forest_c = trixi_get_t8code_forest(handle)
     @test forest_c isa Ptr{Trixi.t8_forest}
     @test forest_c != C_NULL
+
+    # compare map from elements to forest
+    nelements = trixi_nelements(handle)
+    tree_ids_c = zeros(Cint, nelements)
+    local_ids_c = zeros(Cint, nelements)
+    trixi_load_element_tree_map(handle, pointer(tree_ids_c), pointer(local_ids_c))
+    tree_ids_jl = zeros(Cint, nelements)
+    local_ids_jl = zeros(Cint, nelements)
+    trixi_load_element_tree_map_jl(simstate_jl, tree_ids_jl, local_ids_jl)
+    @test tree_ids_c == tree_ids_jl
+    @test local_ids_c == local_ids_jl
+    for itree in 0:(Trixi.t8_forest_get_num_local_trees(forest_c) - 1)
+        @test local_ids_c[tree_ids_c .== itree] ==
+            0:(Trixi.t8_forest_get_tree_num_elements(forest_c, itree) - 1)
+    end
+end
+
+
+@testset verbose=true showtiming=true "Node coordinates" begin
+    # compare physical node coordinates
+    size_c = trixi_ndims(handle) * trixi_ndofs(handle)
+    data_c = zeros(size_c)
+    trixi_load_node_coordinates(handle, pointer(data_c))
+    data_jl = zeros(trixi_ndims_jl(simstate_jl) * trixi_ndofs_jl(simstate_jl))
+    trixi_load_node_coordinates_jl(simstate_jl, data_jl)
+    @test data_c == data_jl
+    data_ptr_c = trixi_get_node_coordinates_pointer(handle)
+    @test unsafe_wrap(Array, data_ptr_c, size_c) == data_c
 end
 
 
@@ -0,0 +1,412 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <trixi.h>
+
+// Number of timed calls per API function (can be overridden on the command line)
+static int nrepetitions = 1000;
+// Number of untimed calls per API function before measuring
+static const int nwarmup = 10;
+// Maximum number of timed time steps
+static const int nsteps_max = 1000;
+// Number of timed simulation setups, which are much more expensive than other calls
+static const int nsimulations = 10;
+// Maximum number of elements in the subset for the `*_var_elements` functions
+static const int nelements_subset_max = 16;
+
+// State shared by all benchmarked calls
+static int handle;
+static int variable_ids[2] = {1, 2};
+static double * buffer = NULL;
+static double * buffer_vars[2] = {NULL, NULL};
+static double * buffer_nodes = NULL;
+static double * buffer_store = NULL;
+static double * buffer_store_elements = NULL;
+static double * buffer_state = NULL;
+static float * buffer_float = NULL;
+static float * buffer_vars_float[2] = {NULL, NULL};
+static int nelements_subset = 0;
+static int * elements_subset = NULL;
+static double register_buffer[3] = {1.0, 2.0, 3.0};
+static double time_dummy = 0.0;
+static volatile double sink = 0.0;
+
+
+// Wrappers with a common signature for all benchmarked API functions
+static void call_version_library_major() { sink += trixi_version_library_major(); }
+static void call_version_library_minor() { sink += trixi_version_library_minor(); }
+static void call_version_library_patch() { sink += trixi_version_library_patch(); }
+static void call_version_library() { sink += trixi_version_library()[0]; }
+static void call_version_julia() { sink += trixi_version_julia()[0]; }
+static void call_version_julia_extended() { sink += trixi_version_julia_extended()[0]; }
+static void call_get_startup_times() {
+    trixi_startup_times_t times;
+    trixi_get_startup_times(&times);
+    sink += times.total;
+}
+static void call_nthreads() { sink += trixi_nthreads(); }
+static void call_is_finished() { sink += trixi_is_finished(handle); }
+static void call_ndims() { sink += trixi_ndims(handle); }
+static void call_nelements() { sink += trixi_nelements(handle); }
+static void call_nelementsglobal() { sink += trixi_nelementsglobal(handle); }
+static void call_element_global_offset() { sink += trixi_element_global_offset(handle); }
+static void call_ndofs() { sink += trixi_ndofs(handle); }
+static void call_ndofsglobal() { sink += trixi_ndofsglobal(handle); }
+static void call_ndofselement() { sink += trixi_ndofselement(handle); }
+static void call_nvariables() { sink += trixi_nvariables(handle); }
+static void call_nnodes() { sink += trixi_nnodes(handle); }
+static void call_calculate_dt() { sink += trixi_calculate_dt(handle); }
+static void call_get_simulation_time() { sink += trixi_get_simulation_time(handle); }
+static void call_load_node_reference_coordinates() {
+    trixi_load_node_reference_coordinates(handle, buffer_nodes);
+}
+static void call_load_node_weights() { trixi_load_node_weights(handle, buffer_nodes); }
+static void call_load_node_coordinates() { trixi_load_node_coordinates(handle, buffer); }
+static void call_load_conservative_var() {
+    trixi_load_conservative_var(handle, 1, buffer);
+}
+static void call_load_conservative_vars() {
+    trixi_load_conservative_vars(handle, 2, variable_ids, buffer_vars);
+}
+static void call_load_primitive_var() { trixi_load_primitive_var(handle, 1, buffer); }
+static void call_load_primitive_vars() {
+    trixi_load_primitive_vars(handle, 2, variable_ids, buffer_vars);
+}
+static void call_load_element_averaged_primitive_var() {
+    trixi_load_element_averaged_primitive_var(handle, 1, buffer);
+}
+static void call_load_conservative_var_float() {
+    trixi_load_conservative_var_float(handle, 1, buffer_float);
+}
+static void call_load_conservative_vars_float() {
+    trixi_load_conservative_vars_float(handle, 2, variable_ids, buffer_vars_float);
+}
+static void call_load_primitive_var_float() {
+    trixi_load_primitive_var_float(handle, 1, buffer_float);
+}
+static void call_load_primitive_vars_float() {
+    trixi_load_primitive_vars_float(handle, 2, variable_ids, buffer_vars_float);
+}
+static void call_load_element_averaged_primitive_var_float() {
+    trixi_load_element_averaged_primitive_var_float(handle, 1, buffer_float);
+}
+static void call_store_conservative_var() {
+    // Store what was loaded before to keep the simulation unchanged
+    trixi_store_conservative_var(handle, 1, buffer_store);
+}
+static void call_load_conservative_var_elements() {
+    trixi_load_conservative_var_elements(handle, 1, nelements_subset, elements_subset,
+                                         buffer);
+}
+static void call_load_primitive_var_elements() {
+    trixi_load_primitive_var_elements(handle, 1, nelements_subset, elements_subset, buffer);
+}
+static void call_store_conservative_var_elements() {
+    // Store what was loaded before to keep the simulation unchanged
+    trixi_store_conservative_var_elements(handle, 1, nelements_subset, elements_subset,
+                                          buffer_store_elements);
+}
+static void call_get_conservative_vars_pointer() {
+    sink += trixi_get_conservative_vars_pointer(handle)[0];
+}
+static void call_get_node_coordinates_pointer() {
+    sink += trixi_get_node_coordinates_pointer(handle)[0];
+}
+// Note: `trixi_step_n` and `trixi_advance_to_time` are called such that no time step is
+//       performed, i.e., only their overhead is measured. The cost of a time step is
+//       measured separately for `trixi_step`.
+static void call_step_n() { sink += trixi_step_n(handle, 0, &time_dummy); }
+static void call_advance_to_time() {
+    sink += trixi_advance_to_time(handle, trixi_get_simulation_time(handle), &time_dummy);
+}
+static void call_register_data() { trixi_register_data(handle, 1, 3, register_buffer); }
+static void call_get_state_layout() {
+    trixi_state_layout_t layout;
+    trixi_get_state_layout(handle, &layout);
+    sink += layout.nelements;
+}
+static void call_mesh_epoch() { sink += trixi_mesh_epoch(handle); }
+static void call_save_state_size() { sink += trixi_save_state_size(handle); }
+static void call_save_state() { trixi_save_state(handle, buffer_state); }
+static void call_integrate_var() { sink += trixi_integrate_var(handle, 1); }
+static void call_norm_var() {
+    double l2, linf;
+    trixi_norm_var(handle, 1, &l2, &linf);
+    sink += l2;
+}
+static void call_minmax_var() {
+    double min, max;
+    trixi_minmax_var(handle, 1, &min, &max);
+    sink += max;
+}
+
+
+// List of benchmarked API functions
+typedef struct {
+    const char * name;
+    void (*call)();
+} benchmark_t;
+
+static const benchmark_t benchmarks[] = {
+    {"trixi_version_library_major", call_version_library_major},
+    {"trixi_version_library_minor", call_version_library_minor},
+    {"trixi_version_library_patch", call_version_library_patch},
+    {"trixi_version_library", call_version_library},
+    {"trixi_version_julia", call_version_julia},
+    {"trixi_version_julia_extended", call_version_julia_extended},
+    {"trixi_get_startup_times", call_get_startup_times},
+    {"trixi_nthreads", call_nthreads},
+    {"trixi_is_finished", call_is_finished},
+    {"trixi_ndims", call_ndims},
+    {"trixi_nelements", call_nelements},
+    {"trixi_nelementsglobal", call_nelementsglobal},
+    {"trixi_element_global_offset", call_element_global_offset},
+    {"trixi_ndofs", call_ndofs},
+    {"trixi_ndofsglobal", call_ndofsglobal},
+    {"trixi_ndofselement", call_ndofselement},
+    {"trixi_nvariables", call_nvariables},
+    {"trixi_nnodes", call_nnodes},
+    {"trixi_calculate_dt", call_calculate_dt},
+    {"trixi_get_simulation_time", call_get_simulation_time},
+    {"trixi_load_node_reference_coordinates", call_load_node_reference_coordinates},
+    {"trixi_load_node_weights", call_load_node_weights},
+    {"trixi_load_node_coordinates", call_load_node_coordinates},
+    {"trixi_load_conservative_var", call_load_conservative_var},
+    {"trixi_load_conservative_vars", call_load_conservative_vars},
+    {"trixi_load_primitive_var", call_load_primitive_var},
+    {"trixi_load_primitive_vars", call_load_primitive_vars},
+    {"trixi_load_element_averaged_primitive_var", call_load_element_averaged_primitive_var},
+    {"trixi_load_conservative_var_float", call_load_conservative_var_float},
+    {"trixi_load_conservative_vars_float", call_load_conservative_vars_float},
+    {"trixi_load_primitive_var_float", call_load_primitive_var_float},
+    {"trixi_load_primitive_vars_float", call_load_primitive_vars_float},
+    {"trixi_load_element_averaged_primitive_var_float",
+     call_load_element_averaged_primitive_var_float},
+    {"trixi_store_conservative_var", call_store_conservative_var},
+    {"trixi_load_conservative_var_elements", call_load_conservative_var_elements},
+    {"trixi_load_primitive_var_elements", call_load_primitive_var_elements},
+    {"trixi_store_conservative_var_elements", call_store_conservative_var_elements},
+    {"trixi_get_conservative_vars_pointer", call_get_conservative_vars_pointer},
+    {"trixi_get_node_coordinates_pointer", call_get_node_coordinates_pointer},
+    {"trixi_get_state_layout", call_get_state_layout},
+    {"trixi_mesh_epoch", call_mesh_epoch},
+    {"trixi_save_state_size", call_save_state_size},
+    {"trixi_save_state", call_save_state},
+    {"trixi_integrate_var", call_integrate_var},
+    {"trixi_norm_var", call_norm_var},
+    {"trixi_minmax_var", call_minmax_var},
+    {"trixi_step_n", call_step_n},
+    {"trixi_advance_to_time", call_advance_to_time},
+    {"trixi_register_data", call_register_data},
+};
+static const int nbenchmarks = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+
+// Wall clock time in nanoseconds
+static double time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return 1.0e9 * ts.tv_sec + ts.tv_nsec;
+}
+
+
+static int compare_doubles(const void * a, const void * b) {
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+
+// Write string as JSON string literal, escaping quotes, backslashes and control characters
+static void write_json_string(FILE * f, const char * s) {
+    fputc('"', f);
+    for (; *s != '\0'; ++s) {
+        if (*s == '"' || *s == '\\') {
+            fprintf(f, "\\%c", *s);
+        } else if ((unsigned char)*s < 0x20) {
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, f);
+        }
+    }
+    fputc('"', f);
+}
+
+
+// Write latency distribution of `n` sorted samples as JSON object members
+static void write_statistics(FILE * f, const double * samples, int n) {
+    double mean = 0.0;
+    for (int i = 0; i < n; ++i) {
+        mean += samples[i];
+    }
+    mean /= n;
+
+    fprintf(f, "\"samples\": %d, \"mean_ns\": %.1f, \"min_ns\": %.1f, \"median_ns\": %.1f, "
+               "\"p90_ns\": %.1f, \"p99_ns\": %.1f, \"max_ns\": %.1f",
+            n, mean, samples[0], samples[n / 2], samples[(int)(0.9 * (n - 1))],
+            samples[(int)(0.99 * (n - 1))], samples[n - 1]);
+}
+
+
+int main ( int argc, char *argv[] ) {
+
+    if ( argc < 3 ) {
+        fprintf(stderr, "ERROR: missing arguments: PROJECT_DIR LIBELIXIR_PATH\n\n");
+        fprintf(stderr, "usage: %s PROJECT_DIR LIBELIXIR_PATH "
+                        "[OUTPUT_JSON [NREPETITIONS]]\n", argv[0]);
+        return 2;
+    }
+    const char * output_path = argc > 3 ? argv[3] : "benchmark_api.json";
+    if ( argc > 4 ) {
+        nrepetitions = atoi(argv[4]);
+        if ( nrepetitions < 1 ) {
+            fprintf(stderr, "ERROR: NREPETITIONS must be positive\n");
+            return 2;
+        }
+    }
+
+    // Initialize Trixi and set up the simulation
+    trixi_initialize( argv[1], NULL );
+    handle = trixi_initialize_simulation( argv[2] );
+
+    // Provide a registry entry for `trixi_register_data` if the libelixir has none
+    char code[256];
+    snprintf(code, 256, "let registry = load_simstate(%d).registry; "
+                        "isempty(registry) && push!(registry, Float64[]); end", handle);
+    trixi_eval_julia( code );
+
+    const int ndofs = trixi_ndofs( handle );
+    const int nnodes = trixi_nnodes( handle );
+    const int ndims = trixi_ndims( handle );
+    const int nvariables = trixi_nvariables( handle );
+    const int nelements = trixi_nelements( handle );
+    buffer = malloc(sizeof(double) * ndofs * ndims);
+    buffer_vars[0] = malloc(sizeof(double) * ndofs);
+    buffer_vars[1] = malloc(sizeof(double) * ndofs);
+    buffer_nodes = malloc(sizeof(double) * nnodes);
+    buffer_store = malloc(sizeof(double) * ndofs);
+    buffer_store_elements = malloc(sizeof(double) * ndofs);
+    buffer_state = malloc(sizeof(double) * trixi_save_state_size( handle ));
+    buffer_float = malloc(sizeof(float) * ndofs);
+    buffer_vars_float[0] = malloc(sizeof(float) * ndofs);
+    buffer_vars_float[1] = malloc(sizeof(float) * ndofs);
+    double * samples = malloc(sizeof(double) * (nrepetitions > nsteps_max ? nrepetitions :
+                                                                            nsteps_max));
+
+    // Only use variable ids that exist
+    if ( nvariables < 2 ) {
+        variable_ids[1] = 1;
+    }
+
+    // Subset of elements spread evenly over the local elements (one-based)
+    nelements_subset = nelements < nelements_subset_max ? nelements : nelements_subset_max;
+    elements_subset = malloc(sizeof(int) * nelements_subset);
+    for (int i = 0; i < nelements_subset; ++i) {
+        elements_subset[i] = 1 + (int)((long)i * nelements / nelements_subset);
+    }
+
+    FILE * f = fopen(output_path, "w");
+    if ( f == NULL ) {
+        fprintf(stderr, "ERROR: could not open output file %s\n", output_path);
+        return 1;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"libtrixi_version\": \"%s\",\n", trixi_version_library());
+    fprintf(f, "  \"libelixir\": ");
+    write_json_string(f, argv[2]);
+    fprintf(f, ",\n");
+    fprintf(f, "  \"nthreads\": %d,\n", trixi_nthreads());
+    fprintf(f, "  \"ndofs\": %d,\n", ndofs);
+    fprintf(f, "  \"nvariables\": %d,\n", nvariables);
+    fprintf(f, "  \"functions\": {\n");
+
+    // Per-call latency of each API function
+    // Note: the buffers for `trixi_store_conservative_var*` need to be filled before
+    trixi_load_conservative_var( handle, 1, buffer_store );
+    trixi_load_conservative_var_elements( handle, 1, nelements_subset, elements_subset,
+                                          buffer_store_elements );
+    int first = 1;
+    for (int b = 0; b < nbenchmarks; ++b) {
+        for (int i = 0; i < nwarmup; ++i) {
+            benchmarks[b].call();
+        }
+        for (int i = 0; i < nrepetitions; ++i) {
+            const double start = time_ns();
+            benchmarks[b].call();
+            samples[i] = time_ns() - start;
+        }
+        qsort(samples, nrepetitions, sizeof(double), compare_doubles);
+
+        fprintf(f, "%s    \"%s\": {", first ? "" : ",\n", benchmarks[b].name);
+        write_statistics(f, samples, nrepetitions);
+        fprintf(f, "}");
+        first = 0;
+
+        printf("%-48s median: %12.1f ns\n", benchmarks[b].name, samples[nrepetitions / 2]);
+    }
+
+    // Setup and teardown of additional simulations with the same libelixir
+    double * samples_finalize = malloc(sizeof(double) * nsimulations);
+    for (int i = 0; i < nsimulations; ++i) {
+        const double start = time_ns();
+        const int handle_tmp = trixi_initialize_simulation( argv[2] );
+        const double end = time_ns();
+        trixi_finalize_simulation( handle_tmp );
+        samples[i] = end - start;
+        samples_finalize[i] = time_ns() - end;
+    }
+    qsort(samples, nsimulations, sizeof(double), compare_doubles);
+    qsort(samples_finalize, nsimulations, sizeof(double), compare_doubles);
+    fprintf(f, ",\n    \"trixi_initialize_simulation\": {");
+    write_statistics(f, samples, nsimulations);
+    fprintf(f, "},\n    \"trixi_finalize_simulation\": {");
+    write_statistics(f, samples_finalize, nsimulations);
+    fprintf(f, "}");
+    printf("%-48s median: %12.1f ns\n", "trixi_initialize_simulation",
+           samples[nsimulations / 2]);
+    printf("%-48s median: %12.1f ns\n", "trixi_finalize_simulation",
+           samples_finalize[nsimulations / 2]);
+    free(samples_finalize);
+    fprintf(f, "\n  },\n");
+
+    // Cost per time step
+    int nsteps = 0;
+    while ( !trixi_is_finished( handle ) && nsteps < nsteps_max ) {
+        const double start = time_ns();
+        trixi_step( handle );
+        samples[nsteps++] = time_ns() - start;
+    }
+    if ( nsteps > 0 ) {
+        qsort(samples, nsteps, sizeof(double), compare_doubles);
+        fprintf(f, "  \"trixi_step\": {");
+        write_statistics(f, samples, nsteps);
+        fprintf(f, ", \"ns_per_dof\": %.3f}\n", samples[nsteps / 2] / ndofs);
+        printf("%-48s median: %12.1f ns\n", "trixi_step", samples[nsteps / 2]);
+    } else {
+        fprintf(f, "  \"trixi_step\": null\n");
+    }
+    fprintf(f, "}\n");
+    fclose(f);
+
+    printf("\nBenchmark results written to %s\n", output_path);
+
+    // Clean up
+    free(samples);
+    free(elements_subset);
+    free(buffer_vars_float[1]);
+    free(buffer_vars_float[0]);
+    free(buffer_float);
+    free(buffer_state);
+    free(buffer_store_elements);
+    free(buffer_store);
+    free(buffer_nodes);
+    free(buffer_vars[1]);
+    free(buffer_vars[0]);
+    free(buffer);
+
+    trixi_finalize_simulation( handle );
+    trixi_finalize();
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <trixi.h>
+
+// Note: Julia can only be initialized once per process, thus every measurement requires a
+//       separate run of this program
+
+
+// Wall clock time in seconds
+static double time_s() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+}
+
+
+// Write string as JSON string literal, escaping quotes, backslashes and control characters
+static void write_json_string(FILE * f, const char * s) {
+    fputc('"', f);
+    for (; *s != '\0'; ++s) {
+        if (*s == '"' || *s == '\\') {
+            fprintf(f, "\\%c", *s);
+        } else if ((unsigned char)*s < 0x20) {
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, f);
+        }
+    }
+    fputc('"', f);
+}
+
+
+int main ( int argc, char *argv[] ) {
+
+    if ( argc < 3 ) {
+        fprintf(stderr, "ERROR: missing arguments: PROJECT_DIR LIBELIXIR_PATH\n\n");
+        fprintf(stderr, "usage: %s PROJECT_DIR LIBELIXIR_PATH "
+                        "[OUTPUT_JSON [SYSIMAGE_PATH]]\n", argv[0]);
+        return 2;
+    }
+    const char * output_path = argc > 3 ? argv[3] : "benchmark_startup.json";
+    const char * sysimage_path = argc > 4 ? argv[4] : NULL;
+
+    // Time to first step, split into the individual phases
+    const double time_start = time_s();
+    trixi_initialize_with_sysimage( argv[1], NULL, sysimage_path, 0, 0 );
+    const double time_initialize = time_s();
+    const int handle = trixi_initialize_simulation( argv[2] );
+    const double time_initialize_simulation = time_s();
+    trixi_step( handle );
+    const double time_first_step = time_s();
+    trixi_step( handle );
+    const double time_second_step = time_s();
+
+    const double initialize = time_initialize - time_start;
+    const double initialize_simulation = time_initialize_simulation - time_initialize;
+    const double first_step = time_first_step - time_initialize_simulation;
+    const double second_step = time_second_step - time_first_step;
+    const double total = time_first_step - time_start;
+
+    trixi_startup_times_t startup_times;
+    trixi_get_startup_times( &startup_times );
+
+    FILE * f = fopen(output_path, "w");
+    if ( f == NULL ) {
+        fprintf(stderr, "ERROR: could not open output file %s\n", output_path);
+        return 1;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"libtrixi_version\": \"%s\",\n", trixi_version_library());
+    fprintf(f, "  \"libelixir\": ");
+    write_json_string(f, argv[2]);
+    fprintf(f, ",\n  \"sysimage\": ");
+    if ( sysimage_path != NULL ) {
+        write_json_string(f, sysimage_path);
+    } else {
+        fprintf(f, "null");
+    }
+    fprintf(f, ",\n");
+    fprintf(f, "  \"nthreads\": %d,\n", trixi_nthreads());
+    fprintf(f, "  \"trixi_initialize\": {\"total_s\": %.6f, \"julia_init_s\": %.6f, "
+               "\"activate_s\": %.6f, \"load_packages_s\": %.6f, "
+               "\"function_pointers_s\": %.6f, \"sysimage_packages\": %d},\n",
+            initialize, startup_times.julia_init, startup_times.activate,
+            startup_times.load_packages, startup_times.function_pointers,
+            startup_times.sysimage_packages);
+    fprintf(f, "  \"trixi_initialize_simulation_s\": %.6f,\n", initialize_simulation);
+    fprintf(f, "  \"first_trixi_step_s\": %.6f,\n", first_step);
+    fprintf(f, "  \"second_trixi_step_s\": %.6f,\n", second_step);
+    fprintf(f, "  \"time_to_first_step_s\": %.6f\n", total);
+    fprintf(f, "}\n");
+    fclose(f);
+
+    printf("%-30s %12.3f s\n", "trixi_initialize", initialize);
+    printf("%-30s %12.3f s\n", "trixi_initialize_simulation", initialize_simulation);
+    printf("%-30s %12.3f s\n", "first trixi_step", first_step);
+    printf("%-30s %12.3f s\n", "second trixi_step", second_step);
+    printf("%-30s %12.3f s\n", "time to first step", total);
+    printf("\nBenchmark results written to %s\n", output_path);
+
+    // Clean up
+    trixi_finalize_simulation( handle );
+    trixi_finalize();
+
+    return 0;
+}
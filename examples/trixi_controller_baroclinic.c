@@ -2,13 +2,9 @@
 #include <stdlib.h>
 #include <math.h>
 
-#include <t8.h>
-#include <t8_forest/t8_forest_general.h>
-#include <t8_forest/t8_forest_geometrical.h>
-
 #include <trixi.h>
 
-void source_terms_baroclinic(int nnodes, double * nodes, t8_forest_t forest,
+void source_terms_baroclinic(int ndofs, const double * node_coords,
                              const double * u1, const double * u2, const double * u3,
                              const double * u4,
                              double * du2, double * du3, double * du4, double * du5) {
@@ -18,49 +14,28 @@ void source_terms_baroclinic(int nnodes, double * nodes, t8_forest_t forest,
     const double angular_velocity = 7.29212e-5;
     const double g_r2 = -gravitational_acceleration * radius_earth * radius_earth;
 
-    double local_coords[3];
-    double global_coords[3];
-
-    // Get the number of trees that have elements
-    t8_locidx_t num_local_trees = t8_forest_get_num_local_trees (forest);
-    // Iterates through all local trees
-    for (t8_locidx_t itree = 0, index = 0; itree < num_local_trees; ++itree) {
-        // Get number of elements of this tree
-        t8_locidx_t num_elements_in_tree = t8_forest_get_tree_num_elements (forest, itree);
-        // Iterate through all the local elements
-        for (t8_locidx_t ielement = 0; ielement < num_elements_in_tree; ++ielement) {
-            // Get a pointer to the current element
-            const t8_element_t *element = t8_forest_get_element_in_tree (forest, itree, ielement);
-            for (int k = 0; k < nnodes; ++k) {
-                for (int j = 0; j < nnodes; ++j) {
-                    for (int i = 0; i < nnodes; ++i, ++index) {
-                        // Get global coordinates of local quad point
-                        local_coords[0] = nodes[i];
-                        local_coords[1] = nodes[j];
-                        local_coords[2] = nodes[k];
-                        t8_forest_element_from_ref_coords(forest, itree, element, local_coords, 1, global_coords);
-
-                        // The actual computation of source terms
-                        const double ele = sqrt( global_coords[0]*global_coords[0] +
-                                                 global_coords[1]*global_coords[1] +
-                                                 global_coords[2]*global_coords[2] );
-
-                        const double ele_corrected = fmax( ele - radius_earth, 0.0) + radius_earth;
-                        // Gravity term
-                        const double temp = g_r2 / (ele_corrected*ele_corrected*ele_corrected);
-                        du2[index] = temp * u1[index] * global_coords[0];
-                        du3[index] = temp * u1[index] * global_coords[1];
-                        du4[index] = temp * u1[index] * global_coords[2];
-                        du5[index] = temp * u1[index] * (u2[index] * global_coords[0] +
-                                                         u3[index] * global_coords[1] +
-                                                         u4[index] * global_coords[2]);
-                        // Coriolis term
-                        du2[index] += 2.0 * angular_velocity * u3[index] * u1[index];
-                        du3[index] -= 2.0 * angular_velocity * u2[index] * u1[index];
-                    }
-                }
-            }
-        }
+    // Iterate through all local degrees of freedom
+    for (int index = 0; index < ndofs; ++index) {
+        // Get global coordinates of local quad point
+        const double * global_coords = node_coords + 3 * index;
+
+        // The actual computation of source terms
+        const double ele = sqrt( global_coords[0]*global_coords[0] +
+                                 global_coords[1]*global_coords[1] +
+                                 global_coords[2]*global_coords[2] );
+
+        const double ele_corrected = fmax( ele - radius_earth, 0.0) + radius_earth;
+        // Gravity term
+        const double temp = g_r2 / (ele_corrected*ele_corrected*ele_corrected);
+        du2[index] = temp * u1[index] * global_coords[0];
+        du3[index] = temp * u1[index] * global_coords[1];
+        du4[index] = temp * u1[index] * global_coords[2];
+        du5[index] = temp * u1[index] * (u2[index] * global_coords[0] +
+                                         u3[index] * global_coords[1] +
+                                         u4[index] * global_coords[2]);
+        // Coriolis term
+        du2[index] += 2.0 * angular_velocity * u3[index] * u1[index];
+        du3[index] -= 2.0 * angular_velocity * u2[index] * u1[index];
     }
 }
 
@@ -106,35 +81,25 @@ int main ( int argc, char *argv[] ) {
     trixi_register_data( handle, 3, ndofs, du4 );
     trixi_register_data( handle, 4, ndofs, du5 );
 
-    // Get number of quadrature nodes
-    int nnodes = trixi_nnodes( handle );
-
-    // Allocate memory for quadrature node coordinates
-    double * nodes = calloc( nnodes, sizeof(double) );
+    // Allocate memory for physical node coordinates
+    double * node_coords = calloc( 3 * ndofs, sizeof(double) );
 
-    // Get quadrature node coordinates
-    trixi_load_node_reference_coordinates( handle, nodes );
-
-    // Transform coordinates from [-1,1] to [0,1]
-    for (int i = 0; i < nnodes; ++i) {
-        nodes[i] = 0.5 * (nodes[i] + 1.0);
-    }
+    // Get physical node coordinates once, since the mesh does not change
+    trixi_load_node_coordinates( handle, node_coords );
 
-    // Get t8code forest
-    t8_forest_t forest = trixi_get_t8code_forest(handle);
+    // Primitive variables to be loaded in each step and their target arrays
+    const int prim_var_ids[4] = {1, 2, 3, 4};
+    double * prim_vars[4] = {u1, u2, u3, u4};
     
     // Main loop
     printf("\n*** Trixi controller ***   Entering main loop\n");
     while ( !trixi_is_finished( handle ) ) {
 
         // Get current state
-        trixi_load_primitive_var( handle, 1, u1 );
-        trixi_load_primitive_var( handle, 2, u2 );
-        trixi_load_primitive_var( handle, 3, u3 );
-        trixi_load_primitive_var( handle, 4, u4 );
+        trixi_load_primitive_vars( handle, 4, prim_var_ids, prim_vars );
 
         // Compute source terms
-        source_terms_baroclinic( nnodes, nodes, forest,
+        source_terms_baroclinic( ndofs, node_coords,
                                  u1, u2, u3, u4, du2, du3, du4, du5 );
 
         // Perform next step
@@ -157,7 +122,7 @@ int main ( int argc, char *argv[] ) {
     free(du3);
     free(du4);
     free(du5);
-    free(nodes);
+    free(node_coords);
 
     return 0;
 }
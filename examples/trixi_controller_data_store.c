@@ -37,22 +37,25 @@ int main ( int argc, char *argv[] ) {
 
         if (steps % 100 == 0) {
 
-            // Get number of degrees of freedom
-            int ndofs = trixi_ndofsglobal( handle );
-
-            // Get a pointer to Trixi's internal simulation data
-            double * raw_data = trixi_get_conservative_vars_pointer(handle);
-
-            for (int i = 0; i < ndofs; ++i) {
-                // Density comes first
-                const double rho = raw_data[5*i];
-
-                // Tracer comes last
-                const double rho_tracer = raw_data[5*i + 4];
-
-                // Apply 10% damping to tracer (fraction of density)
-                const double tracer = 0.9 * (rho_tracer / rho);
-                raw_data[5*i + 4] = tracer * rho;
+            // Get a pointer to Trixi's internal simulation data and its layout
+            trixi_state_layout_t layout;
+            trixi_get_state_layout( handle, &layout );
+
+            // Density comes first, tracer comes last
+            const int rho_offset = 0;
+            const int tracer_offset = (layout.nvariables - 1) * layout.variable_stride;
+
+            for (int e = 0; e < layout.nelements; ++e) {
+                for (int n = 0; n < layout.ndofselement; ++n) {
+                    double * node_data = layout.data + e * layout.element_stride
+                                                     + n * layout.node_stride;
+                    const double rho = node_data[rho_offset];
+                    const double rho_tracer = node_data[tracer_offset];
+
+                    // Apply 10% damping to tracer (fraction of density)
+                    const double tracer = 0.9 * (rho_tracer / rho);
+                    node_data[tracer_offset] = tracer * rho;
+                }
             }
         }
 
@@ -1,16 +1,16 @@
 program trixi_controller_data_store_f
   use LibTrixi
   use, intrinsic :: iso_fortran_env, only: error_unit
-  use, intrinsic :: iso_c_binding, only: c_int, c_double, c_f_pointer, c_ptr
+  use, intrinsic :: iso_c_binding, only: c_int, c_double, c_f_pointer
 
   implicit none
 
-  integer(c_int) :: handle, ndofs, steps, i
+  integer(c_int) :: handle, ndofs, steps, i, e, n, j, tracer_offset
   character(len=256) :: argument
   integer, parameter :: dp = selected_real_kind(12)
   real(dp) :: tracer, rho_val, rho_tracer_val
   real(dp), dimension(:), pointer :: rho => null(), rho_tracer => null()
-  type(c_ptr) :: raw_data_c
+  type(trixi_state_layout) :: layout
   real(c_double), dimension(:), pointer :: raw_data
 
 
@@ -53,23 +53,23 @@ program trixi_controller_data_store_f
     steps = steps + 1
 
     if (modulo(steps, 100) == 0) then
-      ! get number of degrees of freedom
-      ndofs = trixi_ndofsglobal(handle)
-
-      ! Get a pointer to Trixi's internal simulation data
-      raw_data_c = trixi_get_conservative_vars_pointer(handle)
-      call c_f_pointer(raw_data_c, raw_data, [ndofs])
-
-      do i = 1,ndofs
-        ! density comes first
-        rho_val = raw_data(5*(i-1) + 1 )
-
-        ! tracer comes last
-        rho_tracer_val = raw_data(5*i)
-
-        ! Apply 10% damping to tracer (fraction of density)
-        tracer = 0.9 * (rho_tracer_val / rho_val)
-        raw_data(5*i) = tracer * rho_val
+      ! Get a pointer to Trixi's internal simulation data and its layout
+      call trixi_get_state_layout(handle, layout)
+      call c_f_pointer(layout%data, raw_data, [layout%nelements * layout%element_stride])
+
+      ! density comes first, tracer comes last
+      tracer_offset = (layout%nvariables - 1) * layout%variable_stride
+
+      do e = 0,layout%nelements-1
+        do n = 0,layout%ndofselement-1
+          j = e * layout%element_stride + n * layout%node_stride + 1
+          rho_val = raw_data(j)
+          rho_tracer_val = raw_data(j + tracer_offset)
+
+          ! Apply 10% damping to tracer (fraction of density)
+          tracer = 0.9 * (rho_tracer_val / rho_val)
+          raw_data(j + tracer_offset) = tracer * rho_val
+        end do
       end do
     end if
 
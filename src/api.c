@@ -37,6 +37,50 @@ enum {
     TRIXI_FTPR_EVAL_JULIA,
     TRIXI_FTPR_GET_T8CODE_FOREST,
     TRIXI_FPTR_GET_SIMULATION_TIME,
+    TRIXI_FPTR_STEP_N,
+    TRIXI_FPTR_ADVANCE_TO_TIME,
+    TRIXI_FPTR_LOAD_CONSERVATIVE_VARS,
+    TRIXI_FPTR_LOAD_PRIMITIVE_VARS,
+    TRIXI_FPTR_GET_STATE_LAYOUT,
+    TRIXI_FPTR_REGISTER_SOURCE_TERMS,
+    TRIXI_FPTR_LOAD_NODE_COORDINATES,
+    TRIXI_FPTR_GET_NODE_COORDINATES_POINTER,
+    TRIXI_FPTR_NTHREADS,
+    TRIXI_FPTR_SAVE_STATE_SIZE,
+    TRIXI_FPTR_SAVE_STATE,
+    TRIXI_FPTR_RESTORE_STATE,
+    TRIXI_FPTR_CHECKPOINT_ASYNC,
+    TRIXI_FPTR_CHECKPOINT_WAIT,
+    TRIXI_FPTR_WRITE_RESTART,
+    TRIXI_FPTR_INITIALIZE_SIMULATION_FROM_RESTART,
+    TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_FLOAT,
+    TRIXI_FPTR_LOAD_CONSERVATIVE_VARS_FLOAT,
+    TRIXI_FPTR_LOAD_PRIMITIVE_VAR_FLOAT,
+    TRIXI_FPTR_LOAD_PRIMITIVE_VARS_FLOAT,
+    TRIXI_FPTR_LOAD_ELEMENT_AVERAGED_PRIMITIVE_VAR_FLOAT,
+    TRIXI_FPTR_INTEGRATE_VAR,
+    TRIXI_FPTR_NORM_VAR,
+    TRIXI_FPTR_MINMAX_VAR,
+    TRIXI_FPTR_PROBE_CREATE,
+    TRIXI_FPTR_PROBE_EVAL,
+    TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_ELEMENTS,
+    TRIXI_FPTR_LOAD_PRIMITIVE_VAR_ELEMENTS,
+    TRIXI_FPTR_STORE_CONSERVATIVE_VAR_ELEMENTS,
+    TRIXI_FPTR_MESH_EPOCH,
+    TRIXI_FPTR_REGISTER_MESH_CHANGE_CALLBACK,
+    TRIXI_FPTR_REGISTRY_ALLOC,
+    TRIXI_FPTR_REGISTRY_GET_POINTER,
+    TRIXI_FPTR_SET_REFINEMENT_INDICATOR,
+    TRIXI_FPTR_ELEMENT_GLOBAL_OFFSET,
+    TRIXI_FPTR_LOAD_ELEMENT_TREE_MAP,
+    TRIXI_FPTR_REBALANCE,
+    TRIXI_FPTR_NBOUNDARY_FACES,
+    TRIXI_FPTR_LOAD_BOUNDARY_FACE_ELEMENTS,
+    TRIXI_FPTR_LOAD_BOUNDARY_NODE_COORDINATES,
+    TRIXI_FPTR_LOAD_BOUNDARY_CONSERVATIVE_VAR,
+    TRIXI_FPTR_LOAD_BOUNDARY_PRIMITIVE_VAR,
+    TRIXI_FPTR_REGISTER_BOUNDARY_DATA,
+    TRIXI_FPTR_PROBE_FREE,
 
     // The last one is for the array size
     TRIXI_NUM_FPTRS
@@ -77,13 +121,71 @@ static const char* trixi_function_pointer_names[] = {
     [TRIXI_FTPR_VERSION_JULIA_EXTENDED]               = "trixi_version_julia_extended_cfptr",
     [TRIXI_FTPR_EVAL_JULIA]                           = "trixi_eval_julia_cfptr",
     [TRIXI_FTPR_GET_T8CODE_FOREST]                    = "trixi_get_t8code_forest_cfptr",
-    [TRIXI_FPTR_GET_SIMULATION_TIME]                  = "trixi_get_simulation_time_cfptr"
+    [TRIXI_FPTR_GET_SIMULATION_TIME]                  = "trixi_get_simulation_time_cfptr",
+    [TRIXI_FPTR_STEP_N]                               = "trixi_step_n_cfptr",
+    [TRIXI_FPTR_ADVANCE_TO_TIME]                      = "trixi_advance_to_time_cfptr",
+    [TRIXI_FPTR_LOAD_CONSERVATIVE_VARS]               = "trixi_load_conservative_vars_cfptr",
+    [TRIXI_FPTR_LOAD_PRIMITIVE_VARS]                  = "trixi_load_primitive_vars_cfptr",
+    [TRIXI_FPTR_GET_STATE_LAYOUT]                     = "trixi_get_state_layout_cfptr",
+    [TRIXI_FPTR_REGISTER_SOURCE_TERMS]                = "trixi_register_source_terms_cfptr",
+    [TRIXI_FPTR_LOAD_NODE_COORDINATES]                = "trixi_load_node_coordinates_cfptr",
+    [TRIXI_FPTR_GET_NODE_COORDINATES_POINTER]         = "trixi_get_node_coordinates_pointer_cfptr",
+    [TRIXI_FPTR_NTHREADS]                             = "trixi_nthreads_cfptr",
+    [TRIXI_FPTR_SAVE_STATE_SIZE]                      = "trixi_save_state_size_cfptr",
+    [TRIXI_FPTR_SAVE_STATE]                           = "trixi_save_state_cfptr",
+    [TRIXI_FPTR_RESTORE_STATE]                        = "trixi_restore_state_cfptr",
+    [TRIXI_FPTR_CHECKPOINT_ASYNC]                     = "trixi_checkpoint_async_cfptr",
+    [TRIXI_FPTR_CHECKPOINT_WAIT]                      = "trixi_checkpoint_wait_cfptr",
+    [TRIXI_FPTR_WRITE_RESTART]                        = "trixi_write_restart_cfptr",
+    [TRIXI_FPTR_INITIALIZE_SIMULATION_FROM_RESTART]   =
+        "trixi_initialize_simulation_from_restart_cfptr",
+    [TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_FLOAT]          = "trixi_load_conservative_var_float_cfptr",
+    [TRIXI_FPTR_LOAD_CONSERVATIVE_VARS_FLOAT]         = "trixi_load_conservative_vars_float_cfptr",
+    [TRIXI_FPTR_LOAD_PRIMITIVE_VAR_FLOAT]             = "trixi_load_primitive_var_float_cfptr",
+    [TRIXI_FPTR_LOAD_PRIMITIVE_VARS_FLOAT]            = "trixi_load_primitive_vars_float_cfptr",
+    [TRIXI_FPTR_LOAD_ELEMENT_AVERAGED_PRIMITIVE_VAR_FLOAT] =
+        "trixi_load_element_averaged_primitive_var_float_cfptr",
+    [TRIXI_FPTR_INTEGRATE_VAR]                        = "trixi_integrate_var_cfptr",
+    [TRIXI_FPTR_NORM_VAR]                             = "trixi_norm_var_cfptr",
+    [TRIXI_FPTR_MINMAX_VAR]                           = "trixi_minmax_var_cfptr",
+    [TRIXI_FPTR_PROBE_CREATE]                         = "trixi_probe_create_cfptr",
+    [TRIXI_FPTR_PROBE_EVAL]                           = "trixi_probe_eval_cfptr",
+    [TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_ELEMENTS]       =
+        "trixi_load_conservative_var_elements_cfptr",
+    [TRIXI_FPTR_LOAD_PRIMITIVE_VAR_ELEMENTS]          = "trixi_load_primitive_var_elements_cfptr",
+    [TRIXI_FPTR_STORE_CONSERVATIVE_VAR_ELEMENTS]      =
+        "trixi_store_conservative_var_elements_cfptr",
+    [TRIXI_FPTR_MESH_EPOCH]                           = "trixi_mesh_epoch_cfptr",
+    [TRIXI_FPTR_REGISTER_MESH_CHANGE_CALLBACK]        =
+        "trixi_register_mesh_change_callback_cfptr",
+    [TRIXI_FPTR_REGISTRY_ALLOC]                       = "trixi_registry_alloc_cfptr",
+    [TRIXI_FPTR_REGISTRY_GET_POINTER]                 = "trixi_registry_get_pointer_cfptr",
+    [TRIXI_FPTR_SET_REFINEMENT_INDICATOR]             =
+        "trixi_set_refinement_indicator_cfptr",
+    [TRIXI_FPTR_ELEMENT_GLOBAL_OFFSET]                = "trixi_element_global_offset_cfptr",
+    [TRIXI_FPTR_LOAD_ELEMENT_TREE_MAP]                = "trixi_load_element_tree_map_cfptr",
+    [TRIXI_FPTR_REBALANCE]                            = "trixi_rebalance_cfptr",
+    [TRIXI_FPTR_NBOUNDARY_FACES]                      = "trixi_nboundary_faces_cfptr",
+    [TRIXI_FPTR_LOAD_BOUNDARY_FACE_ELEMENTS]          =
+        "trixi_load_boundary_face_elements_cfptr",
+    [TRIXI_FPTR_LOAD_BOUNDARY_NODE_COORDINATES]       =
+        "trixi_load_boundary_node_coordinates_cfptr",
+    [TRIXI_FPTR_LOAD_BOUNDARY_CONSERVATIVE_VAR]       =
+        "trixi_load_boundary_conservative_var_cfptr",
+    [TRIXI_FPTR_LOAD_BOUNDARY_PRIMITIVE_VAR]          =
+        "trixi_load_boundary_primitive_var_cfptr",
+    [TRIXI_FPTR_REGISTER_BOUNDARY_DATA]               =
+        "trixi_register_boundary_data_cfptr",
+    [TRIXI_FPTR_PROBE_FREE]                           = "trixi_probe_free_cfptr"
 };
 
 // Track initialization/finalization status to prevent unhelpful errors
 static int is_initialized = 0;
 static int is_finalized = 0;
 
+// Wall clock times of the initialization phases
+static trixi_startup_times_t startup_times = {0};
+
 
 
 /******************************************************************************************/
@@ -105,10 +207,73 @@ static int is_finalized = 0;
  * Libtrixi maybe only be initialized once; subsequent calls to `trixi_initialize` are
  * erroneous.
  * 
+ * The number of Julia threads is taken from the environment (`JULIA_NUM_THREADS`). Use
+ * @ref trixi_initialize_with_threads_api_c "trixi_initialize_with_threads" to set it
+ * explicitly.
+ *
  * @param[in]  project_directory  Path to project directory.
  * @param[in]  depot_path         Path to Julia depot path (optional; can be null pointer).
  */
 void trixi_initialize(const char * project_directory, const char * depot_path) {
+    trixi_initialize_with_threads(project_directory, depot_path, 0, 0);
+}
+
+
+/**
+ * @anchor trixi_initialize_with_threads_api_c
+ *
+ * @brief Initialize Julia runtime environment with a given number of threads
+ *
+ * Same as @ref trixi_initialize_api_c "trixi_initialize", but additionally set the number
+ * of Julia threads used for shared-memory parallelism (e.g., in `Trixi.@threaded` loops)
+ * and the number of threads used by Julia's garbage collector. Since Julia reads these
+ * values only once during startup, they cannot be changed after initialization.
+ *
+ * If `nthreads` (`ngcthreads`) is positive, the environment variable `JULIA_NUM_THREADS`
+ * (`JULIA_NUM_GC_THREADS`) is forcefully set to its value. Otherwise, the corresponding
+ * environment variable is not touched and Julia's default behavior applies.
+ *
+ * @param[in]  project_directory  Path to project directory.
+ * @param[in]  depot_path         Path to Julia depot path (optional; can be null pointer).
+ * @param[in]  nthreads           Number of Julia threads (ignored if <= 0)
+ * @param[in]  ngcthreads         Number of Julia GC threads (ignored if <= 0)
+ *
+ * @see @ref trixi_nthreads_api_c "trixi_nthreads"
+ */
+void trixi_initialize_with_threads(const char * project_directory, const char * depot_path,
+                                   int nthreads, int ngcthreads) {
+    trixi_initialize_with_sysimage(project_directory, depot_path, NULL, nthreads,
+                                   ngcthreads);
+}
+
+
+/**
+ * @anchor trixi_initialize_with_sysimage_api_c
+ *
+ * @brief Initialize Julia runtime environment from a custom system image
+ *
+ * Same as @ref trixi_initialize_with_threads_api_c "trixi_initialize_with_threads", but
+ * start Julia from the system image at `sysimage_path` instead of the default one. If the
+ * system image already contains LibTrixi.jl and its dependencies (e.g., when created with
+ * `PackageCompiler.create_sysimage`), activating the project at `project_directory` and
+ * loading the packages is skipped, which reduces the startup time to close to that of the
+ * PackageCompiler.jl build of libtrixi. Otherwise, the project is activated as usual.
+ *
+ * The system image must have been created with the same Julia version that libtrixi is
+ * linked against. The wall clock time spent in each phase of the initialization is
+ * available via @ref trixi_get_startup_times_api_c "trixi_get_startup_times" and printed
+ * if debug output is enabled.
+ *
+ * @param[in]  project_directory  Path to project directory.
+ * @param[in]  depot_path         Path to Julia depot path (optional; can be null pointer).
+ * @param[in]  sysimage_path      Path to system image (optional; can be null pointer to
+ *                                use the default system image).
+ * @param[in]  nthreads           Number of Julia threads (ignored if <= 0)
+ * @param[in]  ngcthreads         Number of Julia GC threads (ignored if <= 0)
+ */
+void trixi_initialize_with_sysimage(const char * project_directory, const char * depot_path,
+                                    const char * sysimage_path, int nthreads,
+                                    int ngcthreads) {
     // Prevent double initialization
     if (is_initialized) {
         print_and_die("trixi_initialize invoked multiple times", LOC);
@@ -116,33 +281,77 @@ void trixi_initialize(const char * project_directory, const char * depot_path) {
     // Initialization after finalization is also erroneous, but finalization requires
     // initialization, so this is already caught above.
 
+    const double time_start = wall_time();
+
     // Update JULIA_DEPOT_PATH environment variable before initializing Julia
     update_depot_path(project_directory, depot_path);
 
-    // Init Julia
-    jl_init();
-
-    // Construct activation command
-    const char * activate = "using Pkg;\n"
-                            "Pkg.activate(\"%s\"; io=devnull);\n";
-    if ( strlen(activate) + strlen(project_directory) + 1 > 1024 ) {
-        print_and_die("buffer size not sufficient for activation command", LOC);
+    // Update thread count environment variables before initializing Julia
+    update_thread_count(nthreads, ngcthreads);
+
+    // Init Julia, optionally from a custom system image
+    if (sysimage_path != NULL) {
+        char bindir[1024];
+        get_julia_bindir(bindir, 1024);
+        jl_init_with_image(bindir, sysimage_path);
+        if (show_debug_output()) {
+            printf("Julia initialized from system image \"%s\"\n", sysimage_path);
+        }
+    } else {
+        jl_init();
     }
-    char buffer[1024];
-    snprintf(buffer, 1024, activate, project_directory);
-
-    // Activate Julia environment
-    checked_eval_string(buffer, LOC);
+    const double time_julia_init = wall_time();
+
+    // Packages contained in the system image are loaded during Julia's initialization
+    const char * is_loaded =
+        "any(pkg -> pkg.name == \"LibTrixi\", keys(Base.loaded_modules))";
+    const int sysimage_packages =
+        sysimage_path != NULL && jl_unbox_bool(checked_eval_string(is_loaded, LOC));
+
+    // Activate Julia environment unless all packages are already available
+    if (!sysimage_packages) {
+        // Construct activation command
+        const char * activate = "using Pkg;\n"
+                                "Pkg.activate(\"%s\"; io=devnull);\n";
+        if ( strlen(activate) + strlen(project_directory) + 1 > 1024 ) {
+            print_and_die("buffer size not sufficient for activation command", LOC);
+        }
+        char buffer[1024];
+        snprintf(buffer, 1024, activate, project_directory);
+
+        checked_eval_string(buffer, LOC);
+    } else if (show_debug_output()) {
+        printf("LibTrixi.jl provided by system image, skipping project activation\n");
+    }
+    const double time_activate = wall_time();
 
     // Load LibTrixi module
     checked_eval_string("using LibTrixi;", LOC);
     if (show_debug_output()) {
         checked_eval_string("println(\"Module LibTrixi.jl loaded\")", LOC);
     }
+    const double time_load_packages = wall_time();
 
     // Store function pointers to avoid overhead of `jl_eval_string`
     store_function_pointers(TRIXI_NUM_FPTRS, trixi_function_pointer_names,
                             trixi_function_pointers);
+    const double time_end = wall_time();
+
+    // Store startup time breakdown
+    startup_times.julia_init = time_julia_init - time_start;
+    startup_times.activate = time_activate - time_julia_init;
+    startup_times.load_packages = time_load_packages - time_activate;
+    startup_times.function_pointers = time_end - time_load_packages;
+    startup_times.total = time_end - time_start;
+    startup_times.sysimage_packages = sysimage_packages;
+    if (show_debug_output()) {
+        printf("\nlibtrixi startup times:\n");
+        printf("  Julia initialization:  %9.3f s\n", startup_times.julia_init);
+        printf("  project activation:    %9.3f s\n", startup_times.activate);
+        printf("  package loading:       %9.3f s\n", startup_times.load_packages);
+        printf("  function pointers:     %9.3f s\n", startup_times.function_pointers);
+        printf("  total:                 %9.3f s\n", startup_times.total);
+    }
 
     // Show version info
     if (show_debug_output()) {
@@ -155,6 +364,23 @@ void trixi_initialize(const char * project_directory, const char * depot_path) {
 }
 
 
+/**
+ * @anchor trixi_get_startup_times_api_c
+ *
+ * @brief Get wall clock times of the initialization phases
+ *
+ * Report how much time was spent in each phase of @ref trixi_initialize_api_c
+ * "trixi_initialize" or one of its variants, e.g., to decide whether using a custom
+ * system image with @ref trixi_initialize_with_sysimage_api_c
+ * "trixi_initialize_with_sysimage" pays off. All times are zero before initialization.
+ *
+ * @param[out]  times  startup time breakdown
+ */
+void trixi_get_startup_times(trixi_startup_times_t * times) {
+    *times = startup_times;
+}
+
+
 /**
  * @anchor trixi_finalize_api_c
  * 
@@ -189,6 +415,69 @@ void trixi_finalize() {
 }
 
 
+/**
+ * @anchor trixi_nthreads_api_c
+ *
+ * @brief Return number of Julia threads
+ *
+ * This function is thread-safe. It must be run after `trixi_initialize` has been called.
+ *
+ * @return Number of threads available to Julia for shared-memory parallelism.
+ */
+int trixi_nthreads() {
+
+    // Get function pointer
+    int (*nthreads)() = trixi_function_pointers[TRIXI_FPTR_NTHREADS];
+
+    // Call function
+    return nthreads();
+}
+
+
+/**
+ * @anchor trixi_gc_safe_enter_api_c
+ *
+ * @brief Mark the calling thread as safe for Julia's garbage collector
+ *
+ * Julia's garbage collector can only run once all threads known to Julia have reached a
+ * safe point. A thread that has called into libtrixi before (in particular, the thread that
+ * called `trixi_initialize`) and then blocks outside of libtrixi, e.g., while joining
+ * other threads that step simulations concurrently, must therefore be marked as GC-safe
+ * for the duration of the blocking operation. Otherwise, a garbage collection triggered
+ * by another thread will deadlock.
+ *
+ * No libtrixi functions may be called by the calling thread until
+ * @ref trixi_gc_safe_leave_api_c "trixi_gc_safe_leave" has been called with the returned
+ * state.
+ *
+ * Other threads may call libtrixi functions without further preparation: they are adopted
+ * by Julia automatically on their first call. Different simulations may be advanced
+ * concurrently from different threads, but a single simulation must not be accessed by
+ * more than one thread at a time. Output callbacks are not thread-safe and must be disabled
+ * or serialized when stepping concurrently.
+ *
+ * @return Previous GC state of the calling thread, to be passed to `trixi_gc_safe_leave`.
+ */
+int trixi_gc_safe_enter() {
+    return jl_gc_safe_enter(jl_current_task->ptls);
+}
+
+
+/**
+ * @anchor trixi_gc_safe_leave_api_c
+ *
+ * @brief Restore the GC state of the calling thread
+ *
+ * Undo a previous call to @ref trixi_gc_safe_enter_api_c "trixi_gc_safe_enter". Afterwards,
+ * the calling thread may use libtrixi functions again.
+ *
+ * @param[in]  state  GC state as returned by `trixi_gc_safe_enter`
+ */
+void trixi_gc_safe_leave(int state) {
+    jl_gc_safe_leave(jl_current_task->ptls, state);
+}
+
+
 
 /******************************************************************************************/
 /* Version information                                                                    */
@@ -407,12 +696,297 @@ void trixi_step(int handle) {
 }
 
 
+/**
+ * @anchor trixi_step_n_api_c
+ *
+ * @brief Perform multiple simulation steps
+ *
+ * Let the simulation identified by handle advance by up to `nsteps` steps. All steps are
+ * performed in a single call to Julia, which avoids the per-step overhead of calling
+ * `trixi_step` repeatedly. Stepping stops early if the final time of the simulation is
+ * reached.
+ *
+ * @param[in]   handle  simulation handle
+ * @param[in]   nsteps  maximum number of steps to perform
+ * @param[out]  time    physical time after the last step (optional; can be null pointer)
+ *
+ * @return Number of steps actually performed
+ *
+ * @see trixi_advance_to_time_api_c
+ */
+int trixi_step_n(int handle, int nsteps, double * time) {
+
+    // Get function pointer
+    int (*step_n)(int, int, double *) = trixi_function_pointers[TRIXI_FPTR_STEP_N];
+
+    // Call function
+    return step_n( handle, nsteps, time );
+}
+
+
+/**
+ * @anchor trixi_advance_to_time_api_c
+ *
+ * @brief Advance simulation up to given physical time
+ *
+ * Let the simulation identified by handle advance until the physical time `target_time` is
+ * reached. The time integrator is instructed to hit `target_time` exactly. All steps are
+ * performed in a single call to Julia. Stepping stops early if the final time of the
+ * simulation is reached before `target_time`.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   target_time  physical time to advance to
+ * @param[out]  time         physical time after the last step (optional; can be null
+ *                           pointer)
+ *
+ * @return Number of steps actually performed
+ *
+ * @see trixi_step_n_api_c
+ */
+int trixi_advance_to_time(int handle, double target_time, double * time) {
+
+    // Get function pointer
+    int (*advance_to_time)(int, double, double *) =
+        trixi_function_pointers[TRIXI_FPTR_ADVANCE_TO_TIME];
+
+    // Call function
+    return advance_to_time( handle, target_time, time );
+}
+
+
+/**
+ * @anchor trixi_rebalance_api_c
+ *
+ * @brief Repartition mesh according to given element weights
+ *
+ * The mesh of the simulation identified by handle is partitioned such that the sum of
+ * `element_weights` is balanced across all MPI ranks. This allows to account for additional
+ * work done per element by the calling program, e.g., expensive source terms, which is not
+ * considered by Trixi.jl's own partitioning.
+ *
+ * The solution and all registry fields allocated by `trixi_registry_alloc` are moved to
+ * their new ranks. If the local mesh changed, the mesh epoch is incremented and a function
+ * registered with `trixi_register_mesh_change_callback` is called. All data depending on
+ * the local elements (e.g., `nelements` or node coordinates) need to be queried again.
+ *
+ * This is a collective operation. It is only available for p4est meshes and does nothing in
+ * serial simulations.
+ *
+ * @param[in]  handle           simulation handle
+ * @param[in]  element_weights  non-negative weight of each local element (size `nelements`)
+ *
+ * @return New number of local elements
+ *
+ * @see trixi_mesh_epoch_api_c
+ */
+int trixi_rebalance(int handle, const double * element_weights) {
+
+    // Get function pointer
+    int (*rebalance)(int, const double *) = trixi_function_pointers[TRIXI_FPTR_REBALANCE];
+
+    // Call function
+    return rebalance(handle, element_weights);
+}
+
+
+/**
+ * @anchor trixi_save_state_size_api_c
+ *
+ * @brief Return size of buffer required for a snapshot of the simulation state
+ *
+ * The size changes whenever the mesh changes, e.g., due to adaptive mesh refinement.
+ *
+ * @param[in]  handle  simulation handle
+ *
+ * @return Number of `double` values required to store a snapshot
+ *
+ * @see trixi_save_state_api_c
+ */
+int trixi_save_state_size(int handle) {
+
+    // Get function pointer
+    int (*save_state_size)(int) = trixi_function_pointers[TRIXI_FPTR_SAVE_STATE_SIZE];
+
+    // Call function
+    return save_state_size( handle );
+}
+
+
+/**
+ * @anchor trixi_save_state_api_c
+ *
+ * @brief Save snapshot of simulation state to memory
+ *
+ * Store the complete state of the time integration in `buffer`. This includes the
+ * solution, all registers of the time integration method (e.g., the stages of low-storage
+ * Runge-Kutta methods), the current time, the time step determined by the
+ * `StepsizeCallback`, and the step counter. Together with
+ * @ref trixi_restore_state_api_c "trixi_restore_state" this allows rolling back a
+ * simulation, e.g., to reject a speculative time step.
+ *
+ * The buffer is owned by the caller and must hold at least
+ * @ref trixi_save_state_size_api_c "trixi_save_state_size" values.
+ *
+ * @param[in]   handle  simulation handle
+ * @param[out]  buffer  snapshot of the simulation state
+ */
+void trixi_save_state(int handle, double * buffer) {
+
+    // Get function pointer
+    void (*save_state)(int, double *) = trixi_function_pointers[TRIXI_FPTR_SAVE_STATE];
+
+    // Call function
+    save_state( handle, buffer );
+}
+
+
+/**
+ * @anchor trixi_restore_state_api_c
+ *
+ * @brief Restore simulation state from snapshot in memory
+ *
+ * Restore the state of the time integration from a snapshot created by
+ * @ref trixi_save_state_api_c "trixi_save_state" for the same simulation. The data is
+ * copied into the existing internal arrays, i.e., no memory is allocated. Continuing the
+ * simulation afterwards gives the same results as continuing it right after the snapshot
+ * was taken.
+ *
+ * Side effects of callbacks executed since the snapshot was taken (e.g., written output
+ * files) are not undone. The snapshot cannot be restored if the mesh has changed in
+ * between.
+ *
+ * @param[in]  handle  simulation handle
+ * @param[in]  buffer  snapshot of the simulation state
+ */
+void trixi_restore_state(int handle, const double * buffer) {
+
+    // Get function pointer
+    void (*restore_state)(int, const double *) =
+        trixi_function_pointers[TRIXI_FPTR_RESTORE_STATE];
+
+    // Call function
+    restore_state( handle, buffer );
+}
+
+
+/**
+ * @anchor trixi_checkpoint_async_api_c
+ *
+ * @brief Write checkpoint in the background
+ *
+ * Start writing the current solution to a file and return immediately. The solution is
+ * copied to an internal staging buffer, such that the simulation can be advanced while the
+ * output is written by a background task. Output settings (e.g., the output directory) are
+ * taken from the `SaveSolutionCallback` of the libelixir, which must be present. Set its
+ * `interval` to zero to disable the regular synchronous output.
+ *
+ * Only one checkpoint per simulation may be pending; if necessary, this function waits for
+ * the previous one. Actual overlap of output and computation requires more than one Julia
+ * thread (see @ref trixi_initialize_with_threads_api_c "trixi_initialize_with_threads").
+ * Otherwise, and always for parallel simulations, the checkpoint is written synchronously,
+ * since the collective output operations must not overlap with those of the time stepping.
+ *
+ * @param[in]  handle  simulation handle
+ *
+ * @see trixi_checkpoint_wait_api_c
+ */
+void trixi_checkpoint_async(int handle) {
+
+    // Get function pointer
+    void (*checkpoint_async)(int) = trixi_function_pointers[TRIXI_FPTR_CHECKPOINT_ASYNC];
+
+    // Call function
+    checkpoint_async( handle );
+}
+
+
+/**
+ * @anchor trixi_checkpoint_wait_api_c
+ *
+ * @brief Wait for checkpoint to be written
+ *
+ * Block until a checkpoint started with
+ * @ref trixi_checkpoint_async_api_c "trixi_checkpoint_async" has been written completely.
+ * Return immediately if no checkpoint is pending.
+ *
+ * @param[in]  handle  simulation handle
+ */
+void trixi_checkpoint_wait(int handle) {
+
+    // Get function pointer
+    void (*checkpoint_wait)(int) = trixi_function_pointers[TRIXI_FPTR_CHECKPOINT_WAIT];
+
+    // Call function
+    checkpoint_wait( handle );
+}
+
+
+/**
+ * @anchor trixi_write_restart_api_c
+ *
+ * @brief Write restart file
+ *
+ * Write the current local solution together with time, time step, and step counter to a
+ * restart file. The file consists of a small header, which describes the simulation and its
+ * partitioning, followed by the raw solution data in Trixi.jl's native memory layout and
+ * byte order. In parallel simulations, each rank writes its own file, with the zero-padded
+ * rank appended to `filename` (e.g., `restart.bin_000001`).
+ *
+ * @param[in]  handle    simulation handle
+ * @param[in]  filename  path to restart file
+ *
+ * @see trixi_initialize_simulation_from_restart_api_c
+ */
+void trixi_write_restart(int handle, const char * filename) {
+
+    // Get function pointer
+    void (*write_restart)(int, const char *) =
+        trixi_function_pointers[TRIXI_FPTR_WRITE_RESTART];
+
+    // Call function
+    write_restart( handle, filename );
+}
+
+
+/**
+ * @anchor trixi_initialize_simulation_from_restart_api_c
+ *
+ * @brief Set up Trixi simulation and continue from restart file
+ *
+ * Set up a simulation from `libelixir` like
+ * @ref trixi_initialize_simulation_api_c "trixi_initialize_simulation", then load the
+ * state stored by @ref trixi_write_restart_api_c "trixi_write_restart". The restart file is
+ * mapped into memory and copied into the solution array in a single pass. Callbacks are
+ * reinitialized at the restart time.
+ *
+ * The libelixir must create the same mesh with the same partitioning as the simulation
+ * that wrote the restart file, which is verified using the file header. Simulations with a
+ * changed mesh (e.g., due to AMR) can therefore not be restarted this way.
+ *
+ * @param[in]  libelixir         Path to libelexir file.
+ * @param[in]  restart_filename  Path to restart file (without rank suffix).
+ *
+ * @return handle (integer) to Trixi simulation instance
+ */
+int trixi_initialize_simulation_from_restart(const char * libelixir,
+                                             const char * restart_filename) {
+
+    // Get function pointer
+    int (*initialize_simulation_from_restart)(const char *, const char *) =
+        trixi_function_pointers[TRIXI_FPTR_INITIALIZE_SIMULATION_FROM_RESTART];
+
+    // Call function
+    return initialize_simulation_from_restart( libelixir, restart_filename );
+}
+
+
 /**
  * @anchor trixi_finalize_simulation_api_c
  *
  * @brief Finalize simulation
  *
- * Finalize the simulation identified by handle. This will also release the handle.
+ * Finalize the simulation identified by handle. This will also release the handle, which
+ * becomes invalid. Subsequently created simulations will receive different handles.
  *
  * @param[in]  handle  simulation handle
  */
@@ -512,6 +1086,31 @@ int trixi_nelementsglobal(int handle) {
 }
 
 
+/**
+ * @anchor trixi_element_global_offset_api_c
+ *
+ * @brief Return global index offset of local elements.
+ *
+ * Elements are numbered consecutively across all MPI ranks. The first local element has
+ * the global index `offset` (in 0-based counting), i.e., local element `i` corresponds to
+ * global element `offset + i`. This is a collective operation in parallel simulations, but
+ * communication only takes place on the first call after each mesh change.
+ *
+ * @param[in]  handle  simulation handle
+ *
+ * @see trixi_nelements_api_c
+ */
+int trixi_element_global_offset(int handle) {
+
+    // Get function pointer
+    int (*element_global_offset)(int) =
+        trixi_function_pointers[TRIXI_FPTR_ELEMENT_GLOBAL_OFFSET];
+
+    // Call function
+    return element_global_offset(handle);
+}
+
+
 /**
  * @anchor trixi_ndofs_api_c
  *
@@ -649,6 +1248,36 @@ void trixi_load_node_weights(int handle, double* node_weights) {
 }
 
 
+/**
+ * @anchor trixi_load_node_coordinates_api_c
+ *
+ * @brief Get physical coordinates of all quadrature nodes.
+ *
+ * The physical coordinates of all local quadrature nodes are stored in the provided array
+ * `node_coords`. Coordinate `d` of degree of freedom `i` (both zero-based) is stored at
+ * `node_coords[d + ndims * i]`, where the degrees of freedom are ordered in the same way
+ * as for `trixi_load_conservative_var`. The given array has to be of correct size, i.e.
+ * `ndims * ndofs`, and memory has to be allocated beforehand.
+ *
+ * The coordinates only change when the mesh changes, so it is usually sufficient to load
+ * them once after initialization and after each mesh adaptation.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[out]  node_coords  physical node coordinates
+ *
+ * @see trixi_get_node_coordinates_pointer_api_c
+ */
+void trixi_load_node_coordinates(int handle, double* node_coords) {
+
+    // Get function pointer
+    void (*load_node_coordinates)(int, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_NODE_COORDINATES];
+
+    // Call function
+    load_node_coordinates(handle, node_coords);
+}
+
+
 /**
  * @anchor trixi_load_conservative_var_api_c
  *
@@ -676,19 +1305,101 @@ void trixi_load_conservative_var(int handle, int variable_id, double * data) {
 
 
 /**
- * @anchor trixi_load_primitive_var_api_c
+ * @anchor trixi_load_conservative_var_float_api_c
  *
- * @brief Load primitive variable
- *
- * The values for the primitive variable at position `variable_id` at every degree of
- * freedom are stored in the given array `data`.
+ * @brief Load conservative variable in single precision
  *
- * The given array has to be of correct size (ndofs) and memory has to be allocated
- * beforehand.
+ * Same as @ref trixi_load_conservative_var_api_c "trixi_load_conservative_var", but the
+ * values are converted to `float` while copying.
  *
- * @param[in]  handle       simulation handle
- * @param[in]  variable_id  index of variable
- * @param[out] data         values for all degrees of freedom
+ * @param[in]   handle       simulation handle
+ * @param[in]   variable_id  index of variable
+ * @param[out]  data         values for all degrees of freedom
+ */
+void trixi_load_conservative_var_float(int handle, int variable_id, float * data) {
+
+    // Get function pointer
+    void (*load_conservative_var_float)(int, int, float *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_FLOAT];
+
+    // Call function
+    load_conservative_var_float(handle, variable_id, data);
+}
+
+
+/**
+ * @anchor trixi_load_conservative_vars_api_c
+ *
+ * @brief Load multiple conservative variables.
+ *
+ * The values for the conservative variables at positions `variable_ids[0]`, ...,
+ * `variable_ids[nvariables-1]` at every degree of freedom are stored in the given arrays
+ * `data[0]`, ..., `data[nvariables-1]`. In contrast to calling
+ * `trixi_load_conservative_var` repeatedly, the internal data is traversed only once.
+ *
+ * Each of the given arrays has to be of correct size (ndofs) and memory has to be
+ * allocated beforehand.
+ *
+ * @param[in]   handle        simulation handle
+ * @param[in]   nvariables    number of variables to load
+ * @param[in]   variable_ids  indices of variables (size nvariables)
+ * @param[out]  data          pointers to arrays receiving the values for all degrees of
+ *                            freedom (size nvariables)
+ *
+ * @see trixi_load_conservative_var_api_c
+ */
+void trixi_load_conservative_vars(int handle, int nvariables, const int * variable_ids,
+                                  double ** data) {
+
+    // Get function pointer
+    void (*load_conservative_vars)(int, int, const int *, double **) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_CONSERVATIVE_VARS];
+
+    // Call function
+    load_conservative_vars(handle, nvariables, variable_ids, data);
+}
+
+
+/**
+ * @anchor trixi_load_conservative_vars_float_api_c
+ *
+ * @brief Load multiple conservative variables in single precision
+ *
+ * Same as @ref trixi_load_conservative_vars_api_c "trixi_load_conservative_vars", but the
+ * values are converted to `float` while copying.
+ *
+ * @param[in]   handle        simulation handle
+ * @param[in]   nvariables    number of variables to load
+ * @param[in]   variable_ids  indices of variables (size nvariables)
+ * @param[out]  data          pointers to arrays receiving the values for all degrees of
+ *                            freedom (size nvariables)
+ */
+void trixi_load_conservative_vars_float(int handle, int nvariables,
+                                        const int * variable_ids, float ** data) {
+
+    // Get function pointer
+    void (*load_conservative_vars_float)(int, int, const int *, float **) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_CONSERVATIVE_VARS_FLOAT];
+
+    // Call function
+    load_conservative_vars_float(handle, nvariables, variable_ids, data);
+}
+
+
+/**
+ * @anchor trixi_load_primitive_var_api_c
+ *
+ * @brief Load primitive variable
+ *
+ * The values for the primitive variable at position `variable_id` at every degree of
+ * freedom are stored in the given array `data`.
+ *
+ * The given array has to be of correct size (ndofs) and memory has to be allocated
+ * beforehand.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  variable_id  index of variable
+ * @param[out] data         values for all degrees of freedom
  */
 void trixi_load_primitive_var(int handle, int variable_id, double * data) {
 
@@ -701,6 +1412,91 @@ void trixi_load_primitive_var(int handle, int variable_id, double * data) {
 }
 
 
+/**
+ * @anchor trixi_load_primitive_var_float_api_c
+ *
+ * @brief Load primitive variable in single precision
+ *
+ * Same as @ref trixi_load_primitive_var_api_c "trixi_load_primitive_var", but the values
+ * are converted to `float` while copying. The conversion from conservative to primitive
+ * variables is still performed in double precision.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  variable_id  index of variable
+ * @param[out] data         values for all degrees of freedom
+ */
+void trixi_load_primitive_var_float(int handle, int variable_id, float * data) {
+
+    // Get function pointer
+    void (*load_primitive_var_float)(int, int, float *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_PRIMITIVE_VAR_FLOAT];
+
+    // Call function
+    load_primitive_var_float(handle, variable_id, data);
+}
+
+
+/**
+ * @anchor trixi_load_primitive_vars_api_c
+ *
+ * @brief Load multiple primitive variables
+ *
+ * The values for the primitive variables at positions `variable_ids[0]`, ...,
+ * `variable_ids[nvariables-1]` at every degree of freedom are stored in the given arrays
+ * `data[0]`, ..., `data[nvariables-1]`. The conversion from conservative to primitive
+ * variables is performed only once per degree of freedom, in contrast to calling
+ * `trixi_load_primitive_var` repeatedly.
+ *
+ * Each of the given arrays has to be of correct size (ndofs) and memory has to be
+ * allocated beforehand.
+ *
+ * @param[in]  handle        simulation handle
+ * @param[in]  nvariables    number of variables to load
+ * @param[in]  variable_ids  indices of variables (size nvariables)
+ * @param[out] data          pointers to arrays receiving the values for all degrees of
+ *                           freedom (size nvariables)
+ *
+ * @see trixi_load_primitive_var_api_c
+ */
+void trixi_load_primitive_vars(int handle, int nvariables, const int * variable_ids,
+                               double ** data) {
+
+    // Get function pointer
+    void (*load_primitive_vars)(int, int, const int *, double **) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_PRIMITIVE_VARS];
+
+    // Call function
+    load_primitive_vars(handle, nvariables, variable_ids, data);
+}
+
+
+/**
+ * @anchor trixi_load_primitive_vars_float_api_c
+ *
+ * @brief Load multiple primitive variables in single precision
+ *
+ * Same as @ref trixi_load_primitive_vars_api_c "trixi_load_primitive_vars", but the values
+ * are converted to `float` while copying. The conversion from conservative to primitive
+ * variables is still performed in double precision.
+ *
+ * @param[in]  handle        simulation handle
+ * @param[in]  nvariables    number of variables to load
+ * @param[in]  variable_ids  indices of variables (size nvariables)
+ * @param[out] data          pointers to arrays receiving the values for all degrees of
+ *                           freedom (size nvariables)
+ */
+void trixi_load_primitive_vars_float(int handle, int nvariables, const int * variable_ids,
+                                     float ** data) {
+
+    // Get function pointer
+    void (*load_primitive_vars_float)(int, int, const int *, float **) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_PRIMITIVE_VARS_FLOAT];
+
+    // Call function
+    load_primitive_vars_float(handle, nvariables, variable_ids, data);
+}
+
+
 /**
  * @anchor trixi_load_element_averaged_primitive_var_api_c
  *
@@ -727,6 +1523,31 @@ void trixi_load_element_averaged_primitive_var(int handle, int variable_id, doub
 }
 
 
+/**
+ * @anchor trixi_load_element_averaged_primitive_var_float_api_c
+ *
+ * @brief Load element averages for primitive variable in single precision
+ *
+ * Same as @ref trixi_load_element_averaged_primitive_var_api_c
+ * "trixi_load_element_averaged_primitive_var", but the averages are computed in double
+ * precision and converted to `float` while copying.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  variable_id  index of variable
+ * @param[out] data         element averaged values for all elements
+ */
+void trixi_load_element_averaged_primitive_var_float(int handle, int variable_id,
+                                                     float * data) {
+
+    // Get function pointer
+    void (*load_element_averaged_primitive_var_float)(int, int, float *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_ELEMENT_AVERAGED_PRIMITIVE_VAR_FLOAT];
+
+    // Call function
+    load_element_averaged_primitive_var_float(handle, variable_id, data);
+}
+
+
 /**
  * @anchor trixi_store_conservative_var_api_c
  *
@@ -752,6 +1573,226 @@ void trixi_store_conservative_var(int handle, int variable_id, double * data) {
 }
 
 
+/**
+ * @anchor trixi_load_conservative_var_elements_api_c
+ *
+ * @brief Load conservative variable on a subset of elements
+ *
+ * The values for the conservative variable at position `variable_id` at every degree of
+ * freedom of the local elements `elements[0]`, ..., `elements[nelements-1]` are stored in
+ * the given array `data`. Element indices are one-based. The degrees of freedom of element
+ * `elements[k]` are stored contiguously starting at `data[k * ndofselement]`, in the same
+ * order as for `trixi_load_conservative_var`. Only the requested elements are traversed.
+ *
+ * The given array has to be of size `nelements * ndofselement` and memory has to be
+ * allocated beforehand.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   variable_id  index of variable
+ * @param[in]   nelements    number of elements in subset
+ * @param[in]   elements     indices of local elements (size nelements)
+ * @param[out]  data         values for all degrees of freedom of the subset
+ *
+ * @see trixi_load_conservative_var_api_c
+ */
+void trixi_load_conservative_var_elements(int handle, int variable_id, int nelements,
+                                          const int * elements, double * data) {
+
+    // Get function pointer
+    void (*load_conservative_var_elements)(int, int, int, const int *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_CONSERVATIVE_VAR_ELEMENTS];
+
+    // Call function
+    load_conservative_var_elements(handle, variable_id, nelements, elements, data);
+}
+
+
+/**
+ * @anchor trixi_load_primitive_var_elements_api_c
+ *
+ * @brief Load primitive variable on a subset of elements
+ *
+ * Same as @ref trixi_load_conservative_var_elements_api_c
+ * "trixi_load_conservative_var_elements", but for the primitive variable at position
+ * `variable_id`.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   variable_id  index of variable
+ * @param[in]   nelements    number of elements in subset
+ * @param[in]   elements     indices of local elements (size nelements)
+ * @param[out]  data         values for all degrees of freedom of the subset
+ *
+ * @see trixi_load_primitive_var_api_c
+ */
+void trixi_load_primitive_var_elements(int handle, int variable_id, int nelements,
+                                       const int * elements, double * data) {
+
+    // Get function pointer
+    void (*load_primitive_var_elements)(int, int, int, const int *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_PRIMITIVE_VAR_ELEMENTS];
+
+    // Call function
+    load_primitive_var_elements(handle, variable_id, nelements, elements, data);
+}
+
+
+/**
+ * @anchor trixi_store_conservative_var_elements_api_c
+ *
+ * @brief Store conservative variable on a subset of elements
+ *
+ * The values for the conservative variable at position `variable_id` at every degree of
+ * freedom of the local elements `elements[0]`, ..., `elements[nelements-1]` are read from
+ * the given array `data`, using the same layout as for
+ * @ref trixi_load_conservative_var_elements_api_c "trixi_load_conservative_var_elements".
+ * All other elements are not modified.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  variable_id  index of variable
+ * @param[in]  nelements    number of elements in subset
+ * @param[in]  elements     indices of local elements (size nelements)
+ * @param[in]  data         values for all degrees of freedom of the subset
+ *
+ * @see trixi_store_conservative_var_api_c
+ */
+void trixi_store_conservative_var_elements(int handle, int variable_id, int nelements,
+                                           const int * elements, const double * data) {
+
+    // Get function pointer
+    void (*store_conservative_var_elements)(int, int, int, const int *, const double *) =
+        trixi_function_pointers[TRIXI_FPTR_STORE_CONSERVATIVE_VAR_ELEMENTS];
+
+    // Call function
+    store_conservative_var_elements(handle, variable_id, nelements, elements, data);
+}
+
+
+/**
+ * @anchor trixi_nboundary_faces_api_c
+ *
+ * @brief Return number of local faces on named boundary
+ *
+ * Boundary faces are identified by the boundary names used in the libelixir (e.g., `x_neg`
+ * for p4est meshes created from trees per dimension). All boundary data is stored for each
+ * node of each face, i.e., for `nnodes^(ndims-1) * nboundary_faces` nodes, face by face.
+ * Only the nodes on the boundary are accessed, such that the amount of data scales with
+ * the size of the boundary instead of the volume.
+ *
+ * Boundary data is only available for p4est and t8code meshes.
+ *
+ * @param[in]  handle  simulation handle
+ * @param[in]  name    boundary name
+ *
+ * @return Number of local boundary faces
+ */
+int trixi_nboundary_faces(int handle, const char * name) {
+
+    // Get function pointer
+    int (*nboundary_faces)(int, const char *) =
+        trixi_function_pointers[TRIXI_FPTR_NBOUNDARY_FACES];
+
+    // Call function
+    return nboundary_faces(handle, name);
+}
+
+
+/**
+ * @anchor trixi_load_boundary_face_elements_api_c
+ *
+ * @brief Load element index of faces on named boundary
+ *
+ * @param[in]   handle    simulation handle
+ * @param[in]   name      boundary name
+ * @param[out]  elements  (1-based) element index of each boundary face (size
+ *                        `nboundary_faces`)
+ *
+ * @see trixi_nboundary_faces_api_c
+ */
+void trixi_load_boundary_face_elements(int handle, const char * name, int * elements) {
+
+    // Get function pointer
+    void (*load_boundary_face_elements)(int, const char *, int *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_BOUNDARY_FACE_ELEMENTS];
+
+    // Call function
+    load_boundary_face_elements(handle, name, elements);
+}
+
+
+/**
+ * @anchor trixi_load_boundary_node_coordinates_api_c
+ *
+ * @brief Load physical coordinates of nodes on named boundary
+ *
+ * The coordinates of each node are stored contiguously.
+ *
+ * @param[in]   handle  simulation handle
+ * @param[in]   name    boundary name
+ * @param[out]  data    node coordinates (size `ndims * nnodes^(ndims-1) * nboundary_faces`)
+ *
+ * @see trixi_nboundary_faces_api_c
+ */
+void trixi_load_boundary_node_coordinates(int handle, const char * name, double * data) {
+
+    // Get function pointer
+    void (*load_boundary_node_coordinates)(int, const char *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_BOUNDARY_NODE_COORDINATES];
+
+    // Call function
+    load_boundary_node_coordinates(handle, name, data);
+}
+
+
+/**
+ * @anchor trixi_load_boundary_conservative_var_api_c
+ *
+ * @brief Load conservative variable at nodes on named boundary
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   name         boundary name
+ * @param[in]   variable_id  index of variable
+ * @param[out]  data         values at boundary nodes (size `nnodes^(ndims-1) *
+ *                           nboundary_faces`)
+ *
+ * @see trixi_nboundary_faces_api_c
+ */
+void trixi_load_boundary_conservative_var(int handle, const char * name, int variable_id,
+                                          double * data) {
+
+    // Get function pointer
+    void (*load_boundary_conservative_var)(int, const char *, int, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_BOUNDARY_CONSERVATIVE_VAR];
+
+    // Call function
+    load_boundary_conservative_var(handle, name, variable_id, data);
+}
+
+
+/**
+ * @anchor trixi_load_boundary_primitive_var_api_c
+ *
+ * @brief Load primitive variable at nodes on named boundary
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   name         boundary name
+ * @param[in]   variable_id  index of variable
+ * @param[out]  data         values at boundary nodes (size `nnodes^(ndims-1) *
+ *                           nboundary_faces`)
+ *
+ * @see trixi_nboundary_faces_api_c
+ */
+void trixi_load_boundary_primitive_var(int handle, const char * name, int variable_id,
+                                       double * data) {
+
+    // Get function pointer
+    void (*load_boundary_primitive_var)(int, const char *, int, double *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_BOUNDARY_PRIMITIVE_VAR];
+
+    // Call function
+    load_boundary_primitive_var(handle, name, variable_id, data);
+}
+
+
 /**
  * @anchor trixi_register_data_api_c
  *
@@ -783,6 +1824,220 @@ void trixi_register_data(int handle, int index, int size, const double * data) {
 }
 
 
+/**
+ * @anchor trixi_register_boundary_data_api_c
+ *
+ * @brief Register outer boundary states for named boundary
+ *
+ * The boundary has to use a `LibTrixiBoundaryCondition` in `init_simstate()` of the
+ * running libelixir. Whenever boundary fluxes are computed, the outer state at each
+ * boundary node is read from `data` and combined with the inner state by the surface flux
+ * of the solver. This allows to impose time-dependent boundary data computed by the calling
+ * program, e.g., for coupling with another solver across the boundary.
+ *
+ * `data` holds all conservative variables at each boundary node, with the variables of
+ * each node stored contiguously and the nodes ordered as for
+ * `trixi_load_boundary_conservative_var`. Memory storage remains on the user side. It can
+ * be updated between time steps without registering it again, but must not be deallocated
+ * as long as it might be accessed. After mesh changes, `data` has to be registered again.
+ *
+ * @param[in]  handle  simulation handle
+ * @param[in]  name    boundary name
+ * @param[in]  data    outer states (size `nvariables * nnodes^(ndims-1) * nboundary_faces`)
+ *
+ * @see trixi_nboundary_faces_api_c
+ */
+void trixi_register_boundary_data(int handle, const char * name, const double * data) {
+
+    // Get function pointer
+    void (*register_boundary_data)(int, const char *, const double *) =
+        trixi_function_pointers[TRIXI_FPTR_REGISTER_BOUNDARY_DATA];
+
+    // Call function
+    register_boundary_data(handle, name, data);
+}
+
+
+/**
+ * @anchor trixi_registry_alloc_api_c
+ *
+ * @brief Allocate data vector in current simulation's registry
+ *
+ * In contrast to `trixi_register_data`, the data vector stored in the registry of the
+ * simulation given by `handle` at given `index` is owned by libtrixi. It holds
+ * `ncomponents` values at each node of each element, using the same layout as the
+ * conservative variables (see `trixi_get_state_layout`), and is initialized to zero.
+ *
+ * Whenever the mesh changes (e.g., due to AMR), the values are transferred to the new mesh:
+ * values of unchanged elements are copied, values of refined or coarsened elements are
+ * projected with the same operators as the solution. In parallel simulations, values are
+ * moved along with their elements when the mesh is repartitioned.
+ *
+ * The registry object has to exist and has to hold enough data references such that access
+ * at `index` is valid. The returned pointer becomes invalid when the mesh changes. Use
+ * `trixi_registry_get_pointer` to obtain the current one, e.g., in a callback registered
+ * with `trixi_register_mesh_change_callback`.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  index        index in registry where data vector will be allocated
+ * @param[in]  ncomponents  number of values per node
+ *
+ * @return Pointer to allocated data vector
+ *
+ * @see trixi_registry_get_pointer_api_c
+ */
+double * trixi_registry_alloc(int handle, int index, int ncomponents) {
+
+    // Get function pointer
+    double * (*registry_alloc)(int, int, int) =
+        trixi_function_pointers[TRIXI_FPTR_REGISTRY_ALLOC];
+
+    // Call function
+    return registry_alloc(handle, index, ncomponents);
+}
+
+
+/**
+ * @anchor trixi_registry_get_pointer_api_c
+ *
+ * @brief Return pointer to data vector allocated in registry
+ *
+ * @param[in]  handle  simulation handle
+ * @param[in]  index   index in registry of data vector allocated by `trixi_registry_alloc`
+ *
+ * @return Pointer to data vector on the current mesh
+ *
+ * @see trixi_registry_alloc_api_c
+ */
+double * trixi_registry_get_pointer(int handle, int index) {
+
+    // Get function pointer
+    double * (*registry_get_pointer)(int, int) =
+        trixi_function_pointers[TRIXI_FPTR_REGISTRY_GET_POINTER];
+
+    // Call function
+    return registry_get_pointer(handle, index);
+}
+
+
+/**
+ * @anchor trixi_register_source_terms_api_c
+ *
+ * @brief Register function to compute source terms
+ *
+ * The function `source_terms` will be called by Trixi.jl whenever the right-hand side is
+ * evaluated, i.e., in every stage of the time integration method and with the
+ * corresponding stage time. It operates directly on Trixi.jl's internal arrays, so no data
+ * has to be copied. The pointer `userdata` is passed through unchanged and may be used to
+ * provide additional data to `source_terms`.
+ *
+ * The libelixir has to pass a `LibTrixiSourceTerms` object as source terms to the
+ * semidiscretization in `init_simstate()`. Passing a null pointer as `source_terms`
+ * deactivates the source terms again.
+ *
+ * @param[in]  handle        simulation handle
+ * @param[in]  source_terms  function to compute source terms (can be null pointer)
+ * @param[in]  userdata      arbitrary pointer passed to `source_terms` (can be null pointer)
+ *
+ * @see trixi_source_terms_t
+ */
+void trixi_register_source_terms(int handle, trixi_source_terms_t source_terms,
+                                 void * userdata) {
+
+    // Get function pointer
+    void (*register_source_terms)(int, trixi_source_terms_t, void *) =
+        trixi_function_pointers[TRIXI_FPTR_REGISTER_SOURCE_TERMS];
+
+    // Call function
+    register_source_terms(handle, source_terms, userdata);
+}
+
+
+/**
+ * @anchor trixi_set_refinement_indicator_api_c
+ *
+ * @brief Set refinement indicator used for the next mesh adaptation
+ *
+ * The values in `indicator` are used by the AMR controller in place of an indicator
+ * computed by Trixi.jl, e.g., to compare against the thresholds of Trixi.jl's
+ * `ControllerThreeLevel`. This allows to drive mesh adaptation by refinement criteria
+ * computed in the calling program.
+ *
+ * The libelixir has to pass a `LibTrixiRefinementIndicator` object as indicator to the AMR
+ * controller in `init_simstate()`. The values are not copied. Memory storage remains on the
+ * user side and must not be deallocated as long as the mesh might be adapted. Since the
+ * number of elements changes with the mesh, the indicator has to be set again after each
+ * mesh change, e.g., in a function registered with `trixi_register_mesh_change_callback`.
+ *
+ * @param[in]  handle     simulation handle
+ * @param[in]  indicator  indicator value for each local element (size `nelements`)
+ */
+void trixi_set_refinement_indicator(int handle, const double * indicator) {
+
+    // Get function pointer
+    void (*set_refinement_indicator)(int, const double *) =
+        trixi_function_pointers[TRIXI_FPTR_SET_REFINEMENT_INDICATOR];
+
+    // Call function
+    set_refinement_indicator(handle, indicator);
+}
+
+
+/**
+ * @anchor trixi_mesh_epoch_api_c
+ *
+ * @brief Return number of mesh changes since initialization
+ *
+ * The mesh epoch starts at zero and is incremented after every time step in which the mesh
+ * was changed, e.g., by adaptive mesh refinement or repartitioning. Sizes such as `ndofs`
+ * and mesh-dependent data such as node coordinates only need to be queried again if the
+ * epoch has changed.
+ *
+ * @param[in]  handle  simulation handle
+ *
+ * @return Current mesh epoch
+ *
+ * @see trixi_register_mesh_change_callback_api_c
+ */
+int trixi_mesh_epoch(int handle) {
+
+    // Get function pointer
+    int (*mesh_epoch)(int) = trixi_function_pointers[TRIXI_FPTR_MESH_EPOCH];
+
+    // Call function
+    return mesh_epoch(handle);
+}
+
+
+/**
+ * @anchor trixi_register_mesh_change_callback_api_c
+ *
+ * @brief Register function to be notified about mesh changes
+ *
+ * The function `callback` will be called at the end of every time step in which the mesh
+ * was changed, i.e., whenever the mesh epoch is incremented. It receives the new epoch and
+ * the numbers of local elements before and after the change, which allows to reallocate
+ * buffers and recompute mesh-dependent data only when necessary. The pointer `userdata` is
+ * passed through unchanged.
+ *
+ * @param[in]  handle    simulation handle
+ * @param[in]  callback  function to notify (can be null pointer to deactivate)
+ * @param[in]  userdata  arbitrary pointer passed to `callback` (can be null pointer)
+ *
+ * @see trixi_mesh_change_callback_t, trixi_mesh_epoch_api_c
+ */
+void trixi_register_mesh_change_callback(int handle, trixi_mesh_change_callback_t callback,
+                                         void * userdata) {
+
+    // Get function pointer
+    void (*register_mesh_change_callback)(int, trixi_mesh_change_callback_t, void *) =
+        trixi_function_pointers[TRIXI_FPTR_REGISTER_MESH_CHANGE_CALLBACK];
+
+    // Call function
+    register_mesh_change_callback(handle, callback, userdata);
+}
+
+
 /**
  * @anchor trixi_get_conservative_vars_pointer_api_c
  *
@@ -807,6 +2062,228 @@ double * trixi_get_conservative_vars_pointer(int handle) {
 }
 
 
+/**
+ * @anchor trixi_get_node_coordinates_pointer_api_c
+ *
+ * @brief Return pointer to internal node coordinates.
+ *
+ * The returned pointer points to the beginning of the internal array of physical node
+ * coordinates used in Trixi.jl. Its layout is the same as the one described for
+ * `trixi_load_node_coordinates`. The data must not be modified and the pointer becomes
+ * invalid when the mesh changes.
+ *
+ * @param[in]  handle  simulation handle
+ *
+ * @see trixi_load_node_coordinates_api_c
+ */
+const double * trixi_get_node_coordinates_pointer(int handle) {
+
+    // Get function pointer
+    const double * (*get_node_coordinates_pointer)(int) =
+        trixi_function_pointers[TRIXI_FPTR_GET_NODE_COORDINATES_POINTER];
+
+    // Call function
+    return get_node_coordinates_pointer(handle);
+}
+
+
+/**
+ * @anchor trixi_get_state_layout_api_c
+ *
+ * @brief Describe memory layout of internal data vector.
+ *
+ * Fill `layout` with the pointer to the internal data array used in Trixi.jl (see
+ * `trixi_get_conservative_vars_pointer`) together with the strides required to address
+ * each variable at each node of each element. This allows to operate directly on the
+ * internal data, independent of the equation system and the number of spatial dimensions.
+ *
+ * The information is only valid until the mesh changes, e.g., due to adaptive mesh
+ * refinement. The same caveats as for `trixi_get_conservative_vars_pointer` apply when
+ * writing to the data.
+ *
+ * @param[in]   handle  simulation handle
+ * @param[out]  layout  layout description
+ *
+ * @see trixi_get_conservative_vars_pointer_api_c
+ */
+void trixi_get_state_layout(int handle, trixi_state_layout_t * layout) {
+
+    // Get function pointer
+    void (*get_state_layout)(int, trixi_state_layout_t *) =
+        trixi_function_pointers[TRIXI_FPTR_GET_STATE_LAYOUT];
+
+    // Call function
+    get_state_layout(handle, layout);
+}
+
+
+/**
+ * @anchor trixi_integrate_var_api_c
+ *
+ * @brief Integrate conservative variable over the whole domain
+ *
+ * The integral is computed with the quadrature weights and the volume elements of all
+ * elements and reduced over all MPI ranks. Only a single value is transferred, in contrast
+ * to loading the variable with `trixi_load_conservative_var` and integrating it manually.
+ *
+ * @warning This is a collective operation and has to be called on all MPI ranks.
+ *
+ * @param[in]  handle       simulation handle
+ * @param[in]  variable_id  index of variable
+ *
+ * @return Integral of the conservative variable over the whole domain
+ */
+double trixi_integrate_var(int handle, int variable_id) {
+
+    // Get function pointer
+    double (*integrate_var)(int, int) = trixi_function_pointers[TRIXI_FPTR_INTEGRATE_VAR];
+
+    // Call function
+    return integrate_var(handle, variable_id);
+}
+
+
+/**
+ * @anchor trixi_norm_var_api_c
+ *
+ * @brief Compute L2 and Linf norms of conservative variable over the whole domain
+ *
+ * The L2 norm is normalized by the volume of the domain, as for the error norms reported by
+ * Trixi.jl's analysis callback. The Linf norm is the maximum absolute value at all nodes.
+ * Both norms are computed in a single pass and reduced over all MPI ranks.
+ *
+ * @warning This is a collective operation and has to be called on all MPI ranks.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   variable_id  index of variable
+ * @param[out]  l2           L2 norm
+ * @param[out]  linf         Linf norm
+ */
+void trixi_norm_var(int handle, int variable_id, double * l2, double * linf) {
+
+    // Get function pointer
+    void (*norm_var)(int, int, double *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_NORM_VAR];
+
+    // Call function
+    norm_var(handle, variable_id, l2, linf);
+}
+
+
+/**
+ * @anchor trixi_minmax_var_api_c
+ *
+ * @brief Compute global minimum and maximum of conservative variable
+ *
+ * The extrema are taken over all nodes of all elements and reduced over all MPI ranks in a
+ * single operation.
+ *
+ * @warning This is a collective operation and has to be called on all MPI ranks.
+ *
+ * @param[in]   handle       simulation handle
+ * @param[in]   variable_id  index of variable
+ * @param[out]  min          global minimum
+ * @param[out]  max          global maximum
+ */
+void trixi_minmax_var(int handle, int variable_id, double * min, double * max) {
+
+    // Get function pointer
+    void (*minmax_var)(int, int, double *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_MINMAX_VAR];
+
+    // Call function
+    minmax_var(handle, variable_id, min, max);
+}
+
+
+/**
+ * @anchor trixi_probe_create_api_c
+ *
+ * @brief Create probe for evaluating the solution at given points
+ *
+ * The physical points are located once on the mesh, and the containing elements as well as
+ * the interpolation weights are cached. Subsequent evaluations with
+ * @ref trixi_probe_eval_api_c "trixi_probe_eval" thus only scale with the number of points
+ * instead of the number of degrees of freedom.
+ *
+ * Coordinate `d` of point `i` (both zero-based) is read from `xyz[d + ndims * i]`, i.e.,
+ * the same layout as used by `trixi_load_node_coordinates`. Points may lie on any MPI rank.
+ * The probe becomes invalid if the mesh changes and has to be created again. Probes that
+ * are no longer needed should be released with
+ * @ref trixi_probe_free_api_c "trixi_probe_free".
+ *
+ * @warning This is a collective operation and has to be called on all MPI ranks with the
+ *          same points.
+ *
+ * @param[in]  handle   simulation handle
+ * @param[in]  npoints  number of points
+ * @param[in]  xyz      physical coordinates of all points (size ndims * npoints)
+ *
+ * @return Probe index, to be used with `trixi_probe_eval`
+ */
+int trixi_probe_create(int handle, int npoints, const double * xyz) {
+
+    // Get function pointer
+    int (*probe_create)(int, int, const double *) =
+        trixi_function_pointers[TRIXI_FPTR_PROBE_CREATE];
+
+    // Call function
+    return probe_create(handle, npoints, xyz);
+}
+
+
+/**
+ * @anchor trixi_probe_eval_api_c
+ *
+ * @brief Evaluate conservative variables at the points of a probe
+ *
+ * The conservative variables are interpolated with the DG basis at all points of the probe.
+ * The value of variable `variable_ids[j]` at point `i` (both zero-based) is stored in
+ * `data[i + npoints * j]`. Values are available on all MPI ranks. Points outside of the
+ * domain yield NaN.
+ *
+ * @warning This is a collective operation and has to be called on all MPI ranks.
+ *
+ * @param[in]   handle        simulation handle
+ * @param[in]   probe         probe index as returned by `trixi_probe_create`
+ * @param[in]   nvariables    number of variables to evaluate
+ * @param[in]   variable_ids  indices of variables (size nvariables)
+ * @param[out]  data          values at all points (size npoints * nvariables)
+ */
+void trixi_probe_eval(int handle, int probe, int nvariables, const int * variable_ids,
+                      double * data) {
+
+    // Get function pointer
+    void (*probe_eval)(int, int, int, const int *, double *) =
+        trixi_function_pointers[TRIXI_FPTR_PROBE_EVAL];
+
+    // Call function
+    probe_eval(handle, probe, nvariables, variable_ids, data);
+}
+
+
+/**
+ * @anchor trixi_probe_free_api_c
+ *
+ * @brief Free a probe
+ *
+ * Releases the cached data of a probe created with
+ * @ref trixi_probe_create_api_c "trixi_probe_create". The probe index becomes invalid and
+ * may be returned again by subsequent calls to `trixi_probe_create`.
+ *
+ * @param[in]  handle  simulation handle
+ * @param[in]  probe   probe index as returned by `trixi_probe_create`
+ */
+void trixi_probe_free(int handle, int probe) {
+
+    // Get function pointer
+    void (*probe_free)(int, int) = trixi_function_pointers[TRIXI_FPTR_PROBE_FREE];
+
+    // Call function
+    probe_free(handle, probe);
+}
+
+
 /**
  * @anchor trixi_get_simulation_time_api_c
  *
@@ -854,6 +2331,44 @@ t8_forest_t trixi_get_t8code_forest(int handle) {
 }
 
 
+/**
+ * @anchor trixi_load_element_tree_map_api_c
+ *
+ * @brief Load t8code tree and element index of each local element
+ *
+ * For each local element, `tree_ids` receives the (0-based) local tree index and
+ * `local_ids` the (0-based) element index within this tree, as expected by
+ * `t8_forest_get_element_in_tree`. This allows to map Trixi.jl's element ordering to the
+ * forest in flat loops, e.g., over all degrees of freedom, without walking the trees:
+ *
+ * ```c
+ * for (int i = 0; i < ndofs; ++i) {
+ *     const int element = i / ndofs_element;
+ *     const t8_element_t * e =
+ *         t8_forest_get_element_in_tree(forest, tree_ids[element], local_ids[element]);
+ * }
+ * ```
+ *
+ * Only available for t8code meshes. The map needs to be loaded again after mesh changes.
+ *
+ * @param[in]   handle     simulation handle
+ * @param[out]  tree_ids   local tree index of each element (size `nelements`)
+ * @param[out]  local_ids  element index within its tree of each element (size `nelements`)
+ *
+ * @warning The interface to t8code is experimental and implementation details may change
+ *          at any time without warning.
+ */
+void trixi_load_element_tree_map(int handle, int * tree_ids, int * local_ids) {
+
+    // Get function pointer
+    void (*load_element_tree_map)(int, int *, int *) =
+        trixi_function_pointers[TRIXI_FPTR_LOAD_ELEMENT_TREE_MAP];
+
+    // Call function
+    load_element_tree_map(handle, tree_ids, local_ids);
+}
+
+
 
 /******************************************************************************************/
 /* Misc                                                                                   */
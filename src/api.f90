@@ -7,8 +7,49 @@
 !! @{
 
 module LibTrixi
+  use, intrinsic :: iso_c_binding, only: c_int, c_double, c_ptr
   implicit none
 
+  ! Kind parameters are only needed for the derived types below and must not be exported
+  private :: c_int, c_double, c_ptr
+
+  !> Version of the state layout description, incremented on incompatible changes
+  integer(c_int), parameter :: TRIXI_STATE_LAYOUT_VERSION = 1
+
+  !>
+  !! @brief Layout description of the internal state array
+  !!
+  !! The value of variable `v` at node `n` of element `e` (all zero-based) is located at
+  !! offset `v * variable_stride + n * node_stride + e * element_stride` from `data`.
+  !! Strides are given in units of `real(c_double)`.
+  !!
+  !! @see @ref trixi_get_state_layout_api_c "trixi_get_state_layout (C API)"
+  type, bind(c) :: trixi_state_layout
+    type(c_ptr)    :: data
+    integer(c_int) :: version
+    integer(c_int) :: ndims
+    integer(c_int) :: nnodes
+    integer(c_int) :: nvariables
+    integer(c_int) :: ndofselement
+    integer(c_int) :: nelements
+    integer(c_int) :: variable_stride
+    integer(c_int) :: node_stride
+    integer(c_int) :: element_stride
+  end type
+
+  !>
+  !! @brief Wall clock times of the initialization phases in seconds
+  !!
+  !! @see @ref trixi_get_startup_times_api_c "trixi_get_startup_times (C API)"
+  type, bind(c) :: trixi_startup_times
+    real(c_double) :: julia_init
+    real(c_double) :: activate
+    real(c_double) :: load_packages
+    real(c_double) :: function_pointers
+    real(c_double) :: total
+    integer(c_int) :: sysimage_packages
+  end type
+
   interface
     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
     !! Setup                                                                              !!
@@ -40,6 +81,80 @@ module LibTrixi
       character(kind=c_char), dimension(*), intent(in), optional :: depot_path
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_initialize_with_threads_c::trixi_initialize_with_threads_c(project_directory, depot_path, nthreads, ngcthreads)
+    !!
+    !! @brief Initialize Julia runtime environment with a given number of threads (C char
+    !!        pointer version)
+    !!
+    !! Same as @ref trixi_initialize_c::trixi_initialize_c "trixi_initialize_c", but
+    !! additionally set the number of Julia threads and Julia GC threads. Non-positive
+    !! values leave the corresponding environment variables `JULIA_NUM_THREADS` and
+    !! `JULIA_NUM_GC_THREADS` untouched.
+    !!
+    !! @param[in]  project_directory  Path to project directory (C char pointer)
+    !! @param[in]  depot_path         Path to Julia depot path (optional, C char pointer)
+    !! @param[in]  nthreads           Number of Julia threads (ignored if <= 0)
+    !! @param[in]  ngcthreads         Number of Julia GC threads (ignored if <= 0)
+    !!
+    !! @see @ref trixi_initialize_with_threads
+    !!           "trixi_initialize_with_threads (Fortran convenience version)"
+    !! @see @ref trixi_initialize_with_threads_api_c "trixi_initialize_with_threads (C API)"
+    subroutine trixi_initialize_with_threads_c(project_directory, depot_path, nthreads, &
+                                               ngcthreads) &
+        bind(c, name='trixi_initialize_with_threads')
+      use, intrinsic :: iso_c_binding, only: c_char, c_int
+      character(kind=c_char), dimension(*), intent(in) :: project_directory
+      character(kind=c_char), dimension(*), intent(in), optional :: depot_path
+      integer(c_int), value, intent(in) :: nthreads
+      integer(c_int), value, intent(in) :: ngcthreads
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_initialize_with_sysimage_c::trixi_initialize_with_sysimage_c(project_directory, depot_path, sysimage_path, nthreads, ngcthreads)
+    !!
+    !! @brief Initialize Julia runtime environment from a custom system image (C char
+    !!        pointer version)
+    !!
+    !! Same as @ref trixi_initialize_with_threads_c::trixi_initialize_with_threads_c
+    !! "trixi_initialize_with_threads_c", but start Julia from the system image at
+    !! `sysimage_path`. Project activation is skipped if the system image already contains
+    !! LibTrixi.jl.
+    !!
+    !! @param[in]  project_directory  Path to project directory (C char pointer)
+    !! @param[in]  depot_path         Path to Julia depot path (optional, C char pointer)
+    !! @param[in]  sysimage_path      Path to system image (optional, C char pointer)
+    !! @param[in]  nthreads           Number of Julia threads (ignored if <= 0)
+    !! @param[in]  ngcthreads         Number of Julia GC threads (ignored if <= 0)
+    !!
+    !! @see @ref trixi_initialize_with_sysimage
+    !!           "trixi_initialize_with_sysimage (Fortran convenience version)"
+    !! @see @ref trixi_initialize_with_sysimage_api_c
+    !!           "trixi_initialize_with_sysimage (C API)"
+    subroutine trixi_initialize_with_sysimage_c(project_directory, depot_path, &
+                                                sysimage_path, nthreads, ngcthreads) &
+        bind(c, name='trixi_initialize_with_sysimage')
+      use, intrinsic :: iso_c_binding, only: c_char, c_int
+      character(kind=c_char), dimension(*), intent(in) :: project_directory
+      character(kind=c_char), dimension(*), intent(in), optional :: depot_path
+      character(kind=c_char), dimension(*), intent(in), optional :: sysimage_path
+      integer(c_int), value, intent(in) :: nthreads
+      integer(c_int), value, intent(in) :: ngcthreads
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_get_startup_times::trixi_get_startup_times(times)
+    !!
+    !! @brief Get wall clock times of the initialization phases
+    !!
+    !! @param[out]  times  startup time breakdown
+    !!
+    !! @see @ref trixi_get_startup_times_api_c "trixi_get_startup_times (C API)"
+    subroutine trixi_get_startup_times(times) bind(c)
+      import :: trixi_startup_times
+      type(trixi_startup_times), intent(out) :: times
+    end subroutine
+
     !>
     !! @fn LibTrixi::trixi_finalize::trixi_finalize()
     !!
@@ -53,6 +168,45 @@ module LibTrixi
     subroutine trixi_finalize() bind(c)
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_nthreads::trixi_nthreads()
+    !!
+    !! @brief Return number of Julia threads
+    !!
+    !! @return Number of threads available to Julia for shared-memory parallelism
+    !!
+    !! @see @ref trixi_nthreads_api_c "trixi_nthreads (C API)"
+    integer(c_int) function trixi_nthreads() bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_gc_safe_enter::trixi_gc_safe_enter()
+    !!
+    !! @brief Mark the calling thread as safe for Julia's garbage collector
+    !!
+    !! Must be called before the calling thread blocks while other threads use libtrixi.
+    !!
+    !! @return Previous GC state, to be passed to `trixi_gc_safe_leave`
+    !!
+    !! @see @ref trixi_gc_safe_enter_api_c "trixi_gc_safe_enter (C API)"
+    integer(c_int) function trixi_gc_safe_enter() bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_gc_safe_leave::trixi_gc_safe_leave(state)
+    !!
+    !! @brief Restore the GC state of the calling thread
+    !!
+    !! @param[in]  state  GC state as returned by `trixi_gc_safe_enter`
+    !!
+    !! @see @ref trixi_gc_safe_leave_api_c "trixi_gc_safe_leave (C API)"
+    subroutine trixi_gc_safe_leave(state) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: state
+    end subroutine
+
 
 
     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -167,6 +321,29 @@ module LibTrixi
       character(kind=c_char), dimension(*), intent(in) :: libelixir
     end function
 
+    !>
+    !! @fn LibTrixi::trixi_initialize_simulation_from_restart_c::trixi_initialize_simulation_from_restart_c(libelixir, restart_filename)
+    !!
+    !! @brief Set up Trixi simulation and continue from restart file (C char pointer
+    !!        version)
+    !!
+    !! @param[in]  libelixir         Path to libelexir file.
+    !! @param[in]  restart_filename  Path to restart file (without rank suffix).
+    !!
+    !! @return handle (integer) to Trixi simulation instance
+    !!
+    !! @see @ref trixi_initialize_simulation_from_restart
+    !!           "trixi_initialize_simulation_from_restart (Fortran convenience version)"
+    !! @see @ref trixi_initialize_simulation_from_restart_api_c
+    !!           "trixi_initialize_simulation_from_restart (C API)"
+    integer(c_int) function trixi_initialize_simulation_from_restart_c(libelixir, &
+                                                                       restart_filename) &
+      bind(c, name='trixi_initialize_simulation_from_restart')
+      use, intrinsic :: iso_c_binding, only: c_char, c_int
+      character(kind=c_char), dimension(*), intent(in) :: libelixir
+      character(kind=c_char), dimension(*), intent(in) :: restart_filename
+    end function
+
     !>
     !! @fn LibTrixi::trixi_is_finished_c::trixi_is_finished_c(handle)
     !!
@@ -198,6 +375,149 @@ module LibTrixi
       integer(c_int), value, intent(in) :: handle
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_step_n::trixi_step_n(handle, nsteps, time)
+    !!
+    !! @brief Perform multiple simulation steps
+    !!
+    !! @param[in]   handle  simulation handle
+    !! @param[in]   nsteps  maximum number of steps to perform
+    !! @param[out]  time    physical time after the last step (optional)
+    !!
+    !! @return Number of steps actually performed
+    !!
+    !! @see @ref trixi_step_n_api_c "trixi_step_n (C API)"
+    integer(c_int) function trixi_step_n(handle, nsteps, time) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: nsteps
+      real(c_double), intent(out), optional :: time
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_advance_to_time::trixi_advance_to_time(handle, target_time, time)
+    !!
+    !! @brief Advance simulation up to given physical time
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   target_time  physical time to advance to
+    !! @param[out]  time         physical time after the last step (optional)
+    !!
+    !! @return Number of steps actually performed
+    !!
+    !! @see @ref trixi_advance_to_time_api_c "trixi_advance_to_time (C API)"
+    integer(c_int) function trixi_advance_to_time(handle, target_time, time) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), value, intent(in) :: target_time
+      real(c_double), intent(out), optional :: time
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_rebalance::trixi_rebalance(handle, element_weights)
+    !!
+    !! @brief Repartition mesh according to given element weights
+    !!
+    !! @param[in]  handle           simulation handle
+    !! @param[in]  element_weights  non-negative weight of each local element
+    !!
+    !! @return New number of local elements
+    !!
+    !! @see @ref trixi_rebalance_api_c "trixi_rebalance (C API)"
+    integer(c_int) function trixi_rebalance(handle, element_weights) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), dimension(*), intent(in) :: element_weights
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_save_state_size::trixi_save_state_size(handle)
+    !!
+    !! @brief Return size of buffer required for a snapshot of the simulation state
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @return Number of double precision values required to store a snapshot
+    !!
+    !! @see @ref trixi_save_state_size_api_c "trixi_save_state_size (C API)"
+    integer(c_int) function trixi_save_state_size(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_save_state::trixi_save_state(handle, buffer)
+    !!
+    !! @brief Save snapshot of simulation state to memory
+    !!
+    !! @param[in]   handle  simulation handle
+    !! @param[out]  buffer  snapshot of the simulation state, must hold at least
+    !!                      `trixi_save_state_size(handle)` values
+    !!
+    !! @see @ref trixi_save_state_api_c "trixi_save_state (C API)"
+    subroutine trixi_save_state(handle, buffer) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), dimension(*), intent(out) :: buffer
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_restore_state::trixi_restore_state(handle, buffer)
+    !!
+    !! @brief Restore simulation state from snapshot in memory
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  buffer  snapshot of the simulation state created by `trixi_save_state`
+    !!
+    !! @see @ref trixi_restore_state_api_c "trixi_restore_state (C API)"
+    subroutine trixi_restore_state(handle, buffer) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), dimension(*), intent(in) :: buffer
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_checkpoint_async::trixi_checkpoint_async(handle)
+    !!
+    !! @brief Write checkpoint in the background
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @see @ref trixi_checkpoint_async_api_c "trixi_checkpoint_async (C API)"
+    subroutine trixi_checkpoint_async(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_checkpoint_wait::trixi_checkpoint_wait(handle)
+    !!
+    !! @brief Wait for checkpoint to be written
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @see @ref trixi_checkpoint_wait_api_c "trixi_checkpoint_wait (C API)"
+    subroutine trixi_checkpoint_wait(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_write_restart_c::trixi_write_restart_c(handle, filename)
+    !!
+    !! @brief Write restart file (C char pointer version)
+    !!
+    !! @param[in]  handle    simulation handle
+    !! @param[in]  filename  path to restart file (C char pointer)
+    !!
+    !! @see @ref trixi_write_restart "trixi_write_restart (Fortran convenience version)"
+    !! @see @ref trixi_write_restart_api_c "trixi_write_restart (C API)"
+    subroutine trixi_write_restart_c(handle, filename) bind(c, name='trixi_write_restart')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: filename
+    end subroutine
+
     !>
     !! @fn LibTrixi::trixi_finalize_simulation::trixi_finalize_simulation(handle)
     !!
@@ -271,6 +591,19 @@ module LibTrixi
       integer(c_int), value, intent(in) :: handle
     end function
 
+    !>
+    !! @fn LibTrixi::trixi_element_global_offset::trixi_element_global_offset(handle)
+    !!
+    !! @brief Return global index offset of local elements
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @see @ref trixi_element_global_offset_api_c "trixi_element_global_offset (C API)"
+    integer(c_int) function trixi_element_global_offset(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+    end function
+
     !>
     !! @fn LibTrixi::trixi_ndofs::trixi_ndofs(handle)
     !!
@@ -374,6 +707,25 @@ module LibTrixi
       real(c_double), dimension(*), intent(out) :: node_weights
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_load_node_coordinates::trixi_load_node_coordinates(handle, node_coords)
+    !!
+    !! @brief Get physical coordinates of all quadrature nodes.
+    !!
+    !! Coordinate `d` of degree of freedom `i` is stored at `node_coords(d + ndims*(i-1))`.
+    !! The given array has to be of correct size, i.e. `ndims * ndofs`, and memory has to be
+    !! allocated beforehand.
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[out]  node_coords  physical node coordinates
+    !!
+    !! @see @ref trixi_load_node_coordinates_api_c "trixi_load_node_coordinates (C API)"
+    subroutine trixi_load_node_coordinates(handle, node_coords) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), dimension(*), intent(out) :: node_coords
+    end subroutine
+
     !>
     !! @anchor trixi_load_conservative_var_api_c
     !!
@@ -395,6 +747,72 @@ module LibTrixi
       real(c_double), dimension(*), intent(out) :: data
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_load_conservative_var_float::trixi_load_conservative_var_float(handle, variable_id, data)
+    !!
+    !! @brief Load conservative variable in single precision
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   variable_id  index of variable
+    !! @param[out]  data         values for all degrees of freedom
+    !!
+    !! @see @ref trixi_load_conservative_var_float_api_c
+    !!           "trixi_load_conservative_var_float (C API)"
+    subroutine trixi_load_conservative_var_float(handle, variable_id, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_float
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_float), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_conservative_vars_c::trixi_load_conservative_vars_c(handle, nvariables, variable_ids, data)
+    !!
+    !! @brief Load multiple conservative variables (C pointer version)
+    !!
+    !! @param[in]   handle        simulation handle
+    !! @param[in]   nvariables    number of variables to load
+    !! @param[in]   variable_ids  indices of variables
+    !! @param[out]  data          C pointers to arrays receiving the values for all degrees
+    !!                            of freedom
+    !!
+    !! @see @ref trixi_load_conservative_vars
+    !!           "trixi_load_conservative_vars (Fortran convenience version)"
+    !! @see @ref trixi_load_conservative_vars_api_c
+    !!           "trixi_load_conservative_vars (C API)"
+    subroutine trixi_load_conservative_vars_c(handle, nvariables, variable_ids, data) &
+      bind(c, name='trixi_load_conservative_vars')
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: nvariables
+      integer(c_int), dimension(*), intent(in) :: variable_ids
+      type(c_ptr), dimension(*), intent(in) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_conservative_vars_float_c::trixi_load_conservative_vars_float_c(handle, nvariables, variable_ids, data)
+    !!
+    !! @brief Load multiple conservative variables in single precision (C pointer version)
+    !!
+    !! @param[in]   handle        simulation handle
+    !! @param[in]   nvariables    number of variables to load
+    !! @param[in]   variable_ids  indices of variables
+    !! @param[out]  data          C pointers to arrays receiving the values for all degrees
+    !!                            of freedom
+    !!
+    !! @see @ref trixi_load_conservative_vars_float
+    !!           "trixi_load_conservative_vars_float (Fortran convenience version)"
+    !! @see @ref trixi_load_conservative_vars_float_api_c
+    !!           "trixi_load_conservative_vars_float (C API)"
+    subroutine trixi_load_conservative_vars_float_c(handle, nvariables, variable_ids, data) &
+      bind(c, name='trixi_load_conservative_vars_float')
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: nvariables
+      integer(c_int), dimension(*), intent(in) :: variable_ids
+      type(c_ptr), dimension(*), intent(in) :: data
+    end subroutine
+
     !>
     !! @fn LibTrixi::trixi_load_primitive_var::trixi_load_primitive_var(handle, variable_id, data)
     !!
@@ -412,6 +830,72 @@ module LibTrixi
       real(c_double), dimension(*), intent(out) :: data
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_load_primitive_var_float::trixi_load_primitive_var_float(handle, variable_id, data)
+    !!
+    !! @brief Load primitive variable in single precision
+    !!
+    !! @param[in]  handle       simulation handle
+    !! @param[in]  variable_id  index of variable
+    !! @param[out] data         primitive variable values for all degrees of freedom
+    !!
+    !! @see @ref trixi_load_primitive_var_float_api_c
+    !!           "trixi_load_primitive_var_float (C API)"
+    subroutine trixi_load_primitive_var_float(handle, variable_id, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_float
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_float), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_primitive_vars_c::trixi_load_primitive_vars_c(handle, nvariables, variable_ids, data)
+    !!
+    !! @brief Load multiple primitive variables (C pointer version)
+    !!
+    !! @param[in]  handle        simulation handle
+    !! @param[in]  nvariables    number of variables to load
+    !! @param[in]  variable_ids  indices of variables
+    !! @param[out] data          C pointers to arrays receiving the values for all degrees
+    !!                           of freedom
+    !!
+    !! @see @ref trixi_load_primitive_vars
+    !!           "trixi_load_primitive_vars (Fortran convenience version)"
+    !! @see @ref trixi_load_primitive_vars_api_c
+    !!           "trixi_load_primitive_vars (C API)"
+    subroutine trixi_load_primitive_vars_c(handle, nvariables, variable_ids, data) &
+      bind(c, name='trixi_load_primitive_vars')
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: nvariables
+      integer(c_int), dimension(*), intent(in) :: variable_ids
+      type(c_ptr), dimension(*), intent(in) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_primitive_vars_float_c::trixi_load_primitive_vars_float_c(handle, nvariables, variable_ids, data)
+    !!
+    !! @brief Load multiple primitive variables in single precision (C pointer version)
+    !!
+    !! @param[in]  handle        simulation handle
+    !! @param[in]  nvariables    number of variables to load
+    !! @param[in]  variable_ids  indices of variables
+    !! @param[out] data          C pointers to arrays receiving the values for all degrees
+    !!                           of freedom
+    !!
+    !! @see @ref trixi_load_primitive_vars_float
+    !!           "trixi_load_primitive_vars_float (Fortran convenience version)"
+    !! @see @ref trixi_load_primitive_vars_float_api_c
+    !!           "trixi_load_primitive_vars_float (C API)"
+    subroutine trixi_load_primitive_vars_float_c(handle, nvariables, variable_ids, data) &
+      bind(c, name='trixi_load_primitive_vars_float')
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: nvariables
+      integer(c_int), dimension(*), intent(in) :: variable_ids
+      type(c_ptr), dimension(*), intent(in) :: data
+    end subroutine
+
     !>
     !! @fn LibTrixi::trixi_get_simulation_time::trixi_get_simulation_time(handle)
     !!
@@ -444,6 +928,24 @@ module LibTrixi
       real(c_double), dimension(*), intent(out) :: data
     end subroutine
 
+    !>
+    !! @fn LibTrixi::trixi_load_element_averaged_primitive_var_float::trixi_load_element_averaged_primitive_var_float(handle, variable_id, data)
+    !!
+    !! @brief Load element averages for primitive variable in single precision
+    !!
+    !! @param[in]  handle       simulation handle
+    !! @param[in]  variable_id  index of variable
+    !! @param[out] data         averaged values for all elements
+    !!
+    !! @see @ref trixi_load_element_averaged_primitive_var_float_api_c "trixi_load_element_averaged_primitive_var_float (C API)"
+    subroutine trixi_load_element_averaged_primitive_var_float(handle, variable_id, data) &
+      bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_float
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_float), dimension(*), intent(out) :: data
+    end subroutine
+
     !>
     !! @anchor trixi_store_conservative_var_api_c
     !!
@@ -466,30 +968,350 @@ module LibTrixi
     end subroutine
 
     !>
-    !! @fn LibTrixi::trixi_register_data::trixi_register_data(handle, variable_id, data)
+    !! @fn LibTrixi::trixi_load_conservative_var_elements::trixi_load_conservative_var_elements(handle, variable_id, nelements, elements, data)
     !!
-    !! @brief Store data vector in current simulation's registry
+    !! @brief Load conservative variable on a subset of elements
     !!
-    !! @param[in]  handle  simulation handle
-    !! @param[in]  index   index in registry where data vector will be stored
-    !! @param[in]  size    size of given data vector
-    !! @param[in]  data    data vector to store
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   variable_id  index of variable
+    !! @param[in]   nelements    number of elements in subset
+    !! @param[in]   elements     indices of local elements
+    !! @param[out]  data         values for all degrees of freedom of the subset
+    !!                           (size ndofselement x nelements)
+    !!
+    !! @see @ref trixi_load_conservative_var_elements_api_c
+    !!           "trixi_load_conservative_var_elements (C API)"
+    subroutine trixi_load_conservative_var_elements(handle, variable_id, nelements, &
+                                                    elements, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      integer(c_int), value, intent(in) :: nelements
+      integer(c_int), dimension(*), intent(in) :: elements
+      real(c_double), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_primitive_var_elements::trixi_load_primitive_var_elements(handle, variable_id, nelements, elements, data)
     !!
-    !! @see @ref trixi_register_data_api_c "trixi_register_data (C API)"
-    subroutine trixi_register_data(handle, index, size, data) bind(c)
+    !! @brief Load primitive variable on a subset of elements
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   variable_id  index of variable
+    !! @param[in]   nelements    number of elements in subset
+    !! @param[in]   elements     indices of local elements
+    !! @param[out]  data         values for all degrees of freedom of the subset
+    !!                           (size ndofselement x nelements)
+    !!
+    !! @see @ref trixi_load_primitive_var_elements_api_c
+    !!           "trixi_load_primitive_var_elements (C API)"
+    subroutine trixi_load_primitive_var_elements(handle, variable_id, nelements, &
+                                                 elements, data) bind(c)
       use, intrinsic :: iso_c_binding, only: c_int, c_double
       integer(c_int), value, intent(in) :: handle
-      integer(c_int), value, intent(in) :: index
-      integer(c_int), value, intent(in) :: size
-      real(c_double), dimension(*), intent(in) :: data
+      integer(c_int), value, intent(in) :: variable_id
+      integer(c_int), value, intent(in) :: nelements
+      integer(c_int), dimension(*), intent(in) :: elements
+      real(c_double), dimension(*), intent(out) :: data
     end subroutine
 
     !>
-    !! @anchor trixi_get_conservative_vars_pointer_api_c
+    !! @fn LibTrixi::trixi_store_conservative_var_elements::trixi_store_conservative_var_elements(handle, variable_id, nelements, elements, data)
     !!
-    !! @brief Return pointer to internal data vector.
+    !! @brief Store conservative variable on a subset of elements
     !!
-    !! The returned pointer points to the beginning of the internal data array used in
+    !! @param[in]  handle       simulation handle
+    !! @param[in]  variable_id  index of variable
+    !! @param[in]  nelements    number of elements in subset
+    !! @param[in]  elements     indices of local elements
+    !! @param[in]  data         values for all degrees of freedom of the subset
+    !!                          (size ndofselement x nelements)
+    !!
+    !! @see @ref trixi_store_conservative_var_elements_api_c
+    !!           "trixi_store_conservative_var_elements (C API)"
+    subroutine trixi_store_conservative_var_elements(handle, variable_id, nelements, &
+                                                     elements, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      integer(c_int), value, intent(in) :: nelements
+      integer(c_int), dimension(*), intent(in) :: elements
+      real(c_double), dimension(*), intent(in) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_nboundary_faces_c::trixi_nboundary_faces_c(handle, name)
+    !!
+    !! @brief Return number of local faces on named boundary (C char pointer version)
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  name    boundary name (C char pointer)
+    !!
+    !! @return Number of local boundary faces
+    !!
+    !! @see @ref trixi_nboundary_faces "trixi_nboundary_faces (Fortran convenience version)"
+    !! @see @ref trixi_nboundary_faces_api_c "trixi_nboundary_faces (C API)"
+    integer(c_int) function trixi_nboundary_faces_c(handle, name) &
+        bind(c, name='trixi_nboundary_faces')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_load_boundary_face_elements_c::trixi_load_boundary_face_elements_c(handle, name, elements)
+    !!
+    !! @brief Load element index of faces on named boundary (C char pointer version)
+    !!
+    !! @param[in]   handle    simulation handle
+    !! @param[in]   name      boundary name (C char pointer)
+    !! @param[out]  elements  element index of each boundary face (size nboundary_faces)
+    !!
+    !! @see @ref trixi_load_boundary_face_elements
+    !!           "trixi_load_boundary_face_elements (Fortran convenience version)"
+    !! @see @ref trixi_load_boundary_face_elements_api_c
+    !!           "trixi_load_boundary_face_elements (C API)"
+    subroutine trixi_load_boundary_face_elements_c(handle, name, elements) &
+        bind(c, name='trixi_load_boundary_face_elements')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+      integer(c_int), dimension(*), intent(out) :: elements
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_boundary_node_coordinates_c::trixi_load_boundary_node_coordinates_c(handle, name, data)
+    !!
+    !! @brief Load coordinates of nodes on named boundary (C char pointer version)
+    !!
+    !! @param[in]   handle  simulation handle
+    !! @param[in]   name    boundary name (C char pointer)
+    !! @param[out]  data    node coordinates
+    !!                      (size ndims x nnodes^(ndims-1) x nboundary_faces)
+    !!
+    !! @see @ref trixi_load_boundary_node_coordinates
+    !!           "trixi_load_boundary_node_coordinates (Fortran convenience version)"
+    !! @see @ref trixi_load_boundary_node_coordinates_api_c
+    !!           "trixi_load_boundary_node_coordinates (C API)"
+    subroutine trixi_load_boundary_node_coordinates_c(handle, name, data) &
+        bind(c, name='trixi_load_boundary_node_coordinates')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char, c_double
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+      real(c_double), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_boundary_conservative_var_c::trixi_load_boundary_conservative_var_c(handle, name, variable_id, data)
+    !!
+    !! @brief Load conservative variable on named boundary (C char pointer version)
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   name         boundary name (C char pointer)
+    !! @param[in]   variable_id  index of variable
+    !! @param[out]  data         values at boundary nodes
+    !!                           (size nnodes^(ndims-1) x nboundary_faces)
+    !!
+    !! @see @ref trixi_load_boundary_conservative_var
+    !!           "trixi_load_boundary_conservative_var (Fortran convenience version)"
+    !! @see @ref trixi_load_boundary_conservative_var_api_c
+    !!           "trixi_load_boundary_conservative_var (C API)"
+    subroutine trixi_load_boundary_conservative_var_c(handle, name, variable_id, data) &
+        bind(c, name='trixi_load_boundary_conservative_var')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char, c_double
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_double), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_load_boundary_primitive_var_c::trixi_load_boundary_primitive_var_c(handle, name, variable_id, data)
+    !!
+    !! @brief Load primitive variable on named boundary (C char pointer version)
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   name         boundary name (C char pointer)
+    !! @param[in]   variable_id  index of variable
+    !! @param[out]  data         values at boundary nodes
+    !!                           (size nnodes^(ndims-1) x nboundary_faces)
+    !!
+    !! @see @ref trixi_load_boundary_primitive_var
+    !!           "trixi_load_boundary_primitive_var (Fortran convenience version)"
+    !! @see @ref trixi_load_boundary_primitive_var_api_c
+    !!           "trixi_load_boundary_primitive_var (C API)"
+    subroutine trixi_load_boundary_primitive_var_c(handle, name, variable_id, data) &
+        bind(c, name='trixi_load_boundary_primitive_var')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char, c_double
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_double), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_register_data::trixi_register_data(handle, variable_id, data)
+    !!
+    !! @brief Store data vector in current simulation's registry
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  index   index in registry where data vector will be stored
+    !! @param[in]  size    size of given data vector
+    !! @param[in]  data    data vector to store
+    !!
+    !! @see @ref trixi_register_data_api_c "trixi_register_data (C API)"
+    subroutine trixi_register_data(handle, index, size, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: index
+      integer(c_int), value, intent(in) :: size
+      real(c_double), dimension(*), intent(in) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_register_boundary_data_c::trixi_register_boundary_data_c(handle, name, data)
+    !!
+    !! @brief Register outer boundary states for named boundary (C char pointer version)
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  name    boundary name (C char pointer)
+    !! @param[in]  data    outer states
+    !!                     (size nvariables x nnodes^(ndims-1) x nboundary_faces)
+    !!
+    !! @see @ref trixi_register_boundary_data
+    !!           "trixi_register_boundary_data (Fortran convenience version)"
+    !! @see @ref trixi_register_boundary_data_api_c
+    !!           "trixi_register_boundary_data (C API)"
+    subroutine trixi_register_boundary_data_c(handle, name, data) &
+        bind(c, name='trixi_register_boundary_data')
+      use, intrinsic :: iso_c_binding, only: c_int, c_char, c_double
+      integer(c_int), value, intent(in) :: handle
+      character(kind=c_char), dimension(*), intent(in) :: name
+      real(c_double), dimension(*), intent(in), target :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_registry_alloc::trixi_registry_alloc(handle, index, ncomponents)
+    !!
+    !! @brief Allocate data vector in current simulation's registry
+    !!
+    !! The returned C pointer can be converted with `c_f_pointer`. It becomes invalid when
+    !! the mesh changes.
+    !!
+    !! @param[in]  handle       simulation handle
+    !! @param[in]  index        index in registry where data vector will be allocated
+    !! @param[in]  ncomponents  number of values per node
+    !!
+    !! @return Pointer to allocated data vector
+    !!
+    !! @see @ref trixi_registry_alloc_api_c "trixi_registry_alloc (C API)"
+    type (c_ptr) function trixi_registry_alloc(handle, index, ncomponents) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: index
+      integer(c_int), value, intent(in) :: ncomponents
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_registry_get_pointer::trixi_registry_get_pointer(handle, index)
+    !!
+    !! @brief Return pointer to data vector allocated in registry
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  index   index in registry of data vector allocated by
+    !!                     `trixi_registry_alloc`
+    !!
+    !! @return Pointer to data vector on the current mesh
+    !!
+    !! @see @ref trixi_registry_get_pointer_api_c "trixi_registry_get_pointer (C API)"
+    type (c_ptr) function trixi_registry_get_pointer(handle, index) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: index
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_register_source_terms::trixi_register_source_terms(handle, source_terms, userdata)
+    !!
+    !! @brief Register function to compute source terms
+    !!
+    !! The function must be interoperable with `trixi_source_terms_t`, i.e., a `bind(c)`
+    !! subroutine with arguments `(time, u, du, node_coordinates, nelements, userdata)`,
+    !! where `time` and `nelements` are passed by value.
+    !!
+    !! @param[in]  handle        simulation handle
+    !! @param[in]  source_terms  C function pointer to source term function (see `c_funloc`)
+    !! @param[in]  userdata      arbitrary C pointer passed to `source_terms`
+    !!
+    !! @see @ref trixi_register_source_terms_api_c "trixi_register_source_terms (C API)"
+    subroutine trixi_register_source_terms(handle, source_terms, userdata) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_funptr, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      type(c_funptr), value, intent(in) :: source_terms
+      type(c_ptr), value, intent(in) :: userdata
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_set_refinement_indicator::trixi_set_refinement_indicator(handle, indicator)
+    !!
+    !! @brief Set refinement indicator used for the next mesh adaptation
+    !!
+    !! The values are not copied, `indicator` must remain valid as long as the mesh might
+    !! be adapted.
+    !!
+    !! @param[in]  handle     simulation handle
+    !! @param[in]  indicator  indicator value for each local element
+    !!
+    !! @see @ref trixi_set_refinement_indicator_api_c "trixi_set_refinement_indicator (C API)"
+    subroutine trixi_set_refinement_indicator(handle, indicator) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      real(c_double), dimension(*), intent(in) :: indicator
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_mesh_epoch::trixi_mesh_epoch(handle)
+    !!
+    !! @brief Return number of mesh changes since initialization
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @return Current mesh epoch
+    !!
+    !! @see @ref trixi_mesh_epoch_api_c "trixi_mesh_epoch (C API)"
+    integer(c_int) function trixi_mesh_epoch(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_register_mesh_change_callback::trixi_register_mesh_change_callback(handle, callback, userdata)
+    !!
+    !! @brief Register function to be notified about mesh changes
+    !!
+    !! The function must be interoperable with `trixi_mesh_change_callback_t`, i.e., a
+    !! `bind(c)` subroutine with arguments `(epoch, nelements_old, nelements_new, userdata)`,
+    !! where all arguments are passed by value.
+    !!
+    !! @param[in]  handle    simulation handle
+    !! @param[in]  callback  C function pointer to notification function (see `c_funloc`)
+    !! @param[in]  userdata  arbitrary C pointer passed to `callback`
+    !!
+    !! @see @ref trixi_register_mesh_change_callback_api_c
+    !!           "trixi_register_mesh_change_callback (C API)"
+    subroutine trixi_register_mesh_change_callback(handle, callback, userdata) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_funptr, c_ptr
+      integer(c_int), value, intent(in) :: handle
+      type(c_funptr), value, intent(in) :: callback
+      type(c_ptr), value, intent(in) :: userdata
+    end subroutine
+
+    !>
+    !! @anchor trixi_get_conservative_vars_pointer_api_c
+    !!
+    !! @brief Return pointer to internal data vector.
+    !!
+    !! The returned pointer points to the beginning of the internal data array used in
     !! Trixi.jl. This array contains the conservative variables, i.e. density, momentum
     !! density in the three Cartesian coordinates, and energy density, in this sequence.
     !! The pointer can be used to read, but also to write these variables. The latter
@@ -502,6 +1324,146 @@ module LibTrixi
       integer(c_int), value, intent(in) :: handle
     end function
 
+    !>
+    !! @fn LibTrixi::trixi_get_node_coordinates_pointer::trixi_get_node_coordinates_pointer(handle)
+    !!
+    !! @brief Return pointer to internal node coordinates.
+    !!
+    !! @param[in]  handle  simulation handle
+    !!
+    !! @see @ref trixi_get_node_coordinates_pointer_api_c
+    !!           "trixi_get_node_coordinates_pointer (C API)"
+    type (c_ptr) function trixi_get_node_coordinates_pointer(handle) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_ptr
+      integer(c_int), value, intent(in) :: handle
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_get_state_layout::trixi_get_state_layout(handle, layout)
+    !!
+    !! @brief Describe memory layout of internal data vector.
+    !!
+    !! @param[in]   handle  simulation handle
+    !! @param[out]  layout  layout description
+    !!
+    !! @see @ref trixi_get_state_layout_api_c "trixi_get_state_layout (C API)"
+    subroutine trixi_get_state_layout(handle, layout) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      import :: trixi_state_layout
+      integer(c_int), value, intent(in) :: handle
+      type(trixi_state_layout), intent(out) :: layout
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_integrate_var::trixi_integrate_var(handle, variable_id)
+    !!
+    !! @brief Integrate conservative variable over the whole domain (collective)
+    !!
+    !! @param[in]  handle       simulation handle
+    !! @param[in]  variable_id  index of variable
+    !!
+    !! @return Integral of the conservative variable over the whole domain
+    !!
+    !! @see @ref trixi_integrate_var_api_c "trixi_integrate_var (C API)"
+    real(c_double) function trixi_integrate_var(handle, variable_id) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_norm_var::trixi_norm_var(handle, variable_id, l2, linf)
+    !!
+    !! @brief Compute L2 and Linf norms of conservative variable (collective)
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   variable_id  index of variable
+    !! @param[out]  l2           L2 norm, normalized by the domain volume
+    !! @param[out]  linf         Linf norm
+    !!
+    !! @see @ref trixi_norm_var_api_c "trixi_norm_var (C API)"
+    subroutine trixi_norm_var(handle, variable_id, l2, linf) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_double), intent(out) :: l2
+      real(c_double), intent(out) :: linf
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_minmax_var::trixi_minmax_var(handle, variable_id, min, max)
+    !!
+    !! @brief Compute global minimum and maximum of conservative variable (collective)
+    !!
+    !! @param[in]   handle       simulation handle
+    !! @param[in]   variable_id  index of variable
+    !! @param[out]  min          global minimum
+    !! @param[out]  max          global maximum
+    !!
+    !! @see @ref trixi_minmax_var_api_c "trixi_minmax_var (C API)"
+    subroutine trixi_minmax_var(handle, variable_id, min, max) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: variable_id
+      real(c_double), intent(out) :: min
+      real(c_double), intent(out) :: max
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_probe_create::trixi_probe_create(handle, npoints, xyz)
+    !!
+    !! @brief Create probe for evaluating the solution at given points (collective)
+    !!
+    !! @param[in]  handle   simulation handle
+    !! @param[in]  npoints  number of points
+    !! @param[in]  xyz      physical coordinates of all points (size ndims x npoints)
+    !!
+    !! @return Probe index, to be used with trixi_probe_eval
+    !!
+    !! @see @ref trixi_probe_create_api_c "trixi_probe_create (C API)"
+    integer(c_int) function trixi_probe_create(handle, npoints, xyz) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: npoints
+      real(c_double), dimension(*), intent(in) :: xyz
+    end function
+
+    !>
+    !! @fn LibTrixi::trixi_probe_eval::trixi_probe_eval(handle, probe, nvariables, variable_ids, data)
+    !!
+    !! @brief Evaluate conservative variables at the points of a probe (collective)
+    !!
+    !! @param[in]   handle        simulation handle
+    !! @param[in]   probe         probe index as returned by trixi_probe_create
+    !! @param[in]   nvariables    number of variables to evaluate
+    !! @param[in]   variable_ids  indices of variables
+    !! @param[out]  data          values at all points (size npoints x nvariables)
+    !!
+    !! @see @ref trixi_probe_eval_api_c "trixi_probe_eval (C API)"
+    subroutine trixi_probe_eval(handle, probe, nvariables, variable_ids, data) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int, c_double
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: probe
+      integer(c_int), value, intent(in) :: nvariables
+      integer(c_int), dimension(*), intent(in) :: variable_ids
+      real(c_double), dimension(*), intent(out) :: data
+    end subroutine
+
+    !>
+    !! @fn LibTrixi::trixi_probe_free::trixi_probe_free(handle, probe)
+    !!
+    !! @brief Free a probe
+    !!
+    !! @param[in]  handle  simulation handle
+    !! @param[in]  probe   probe index as returned by trixi_probe_create
+    !!
+    !! @see @ref trixi_probe_free_api_c "trixi_probe_free (C API)"
+    subroutine trixi_probe_free(handle, probe) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), value, intent(in) :: probe
+    end subroutine
+
 
 
     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -522,6 +1484,23 @@ module LibTrixi
       integer(c_int), value, intent(in) :: handle
     end function
 
+    !>
+    !! @fn LibTrixi::trixi_load_element_tree_map::trixi_load_element_tree_map(handle, tree_ids, local_ids)
+    !!
+    !! @brief Load t8code tree and element index of each local element
+    !!
+    !! @param[in]   handle     simulation handle
+    !! @param[out]  tree_ids   (0-based) local tree index of each element
+    !! @param[out]  local_ids  (0-based) element index within its tree of each element
+    !!
+    !! @see @ref trixi_load_element_tree_map_api_c "trixi_load_element_tree_map (C API)"
+    subroutine trixi_load_element_tree_map(handle, tree_ids, local_ids) bind(c)
+      use, intrinsic :: iso_c_binding, only: c_int
+      integer(c_int), value, intent(in) :: handle
+      integer(c_int), dimension(*), intent(out) :: tree_ids
+      integer(c_int), dimension(*), intent(out) :: local_ids
+    end subroutine
+
 
 
     !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -568,6 +1547,89 @@ module LibTrixi
     end if
   end subroutine
 
+  !>
+  !! @brief Initialize Julia runtime environment with a given number of threads (Fortran
+  !!        convenience version)
+  !!
+  !! @param[in]  project_directory  Path to project directory (Fortran string).
+  !! @param[in]  nthreads           Number of Julia threads (optional).
+  !! @param[in]  ngcthreads         Number of Julia GC threads (optional).
+  !! @param[in]  depot_path         Path to Julia depot path (Fortran string, optional).
+  !!
+  !! @see @ref trixi_initialize_with_threads_c::trixi_initialize_with_threads_c
+  !!           "trixi_initialize_with_threads_c (C char pointer version)"
+  !! @see @ref trixi_initialize_with_threads_api_c
+  !!           "trixi_initialize_with_threads (C API)"
+  subroutine trixi_initialize_with_threads(project_directory, nthreads, ngcthreads, &
+                                           depot_path)
+    use, intrinsic :: iso_c_binding, only: c_null_char
+    character(len=*), intent(in) :: project_directory
+    integer, intent(in), optional :: nthreads
+    integer, intent(in), optional :: ngcthreads
+    character(len=*), intent(in), optional :: depot_path
+    integer(c_int) :: nthreads_c, ngcthreads_c
+
+    ! Non-positive values are ignored by the C API
+    nthreads_c = 0
+    if (present(nthreads)) nthreads_c = nthreads
+    ngcthreads_c = 0
+    if (present(ngcthreads)) ngcthreads_c = ngcthreads
+
+    if (present(depot_path)) then
+      call trixi_initialize_with_threads_c(trim(adjustl(project_directory)) // c_null_char, &
+                                           trim(adjustl(depot_path)) // c_null_char, &
+                                           nthreads_c, ngcthreads_c)
+    else
+      call trixi_initialize_with_threads_c(trim(adjustl(project_directory)) // c_null_char, &
+                                           nthreads=nthreads_c, ngcthreads=ngcthreads_c)
+    end if
+  end subroutine
+
+  !>
+  !! @brief Initialize Julia runtime environment from a custom system image (Fortran
+  !!        convenience version)
+  !!
+  !! @param[in]  project_directory  Path to project directory (Fortran string).
+  !! @param[in]  sysimage_path      Path to system image (Fortran string).
+  !! @param[in]  nthreads           Number of Julia threads (optional).
+  !! @param[in]  ngcthreads         Number of Julia GC threads (optional).
+  !! @param[in]  depot_path         Path to Julia depot path (Fortran string, optional).
+  !!
+  !! @see @ref trixi_initialize_with_sysimage_c::trixi_initialize_with_sysimage_c
+  !!           "trixi_initialize_with_sysimage_c (C char pointer version)"
+  !! @see @ref trixi_initialize_with_sysimage_api_c
+  !!           "trixi_initialize_with_sysimage (C API)"
+  subroutine trixi_initialize_with_sysimage(project_directory, sysimage_path, nthreads, &
+                                            ngcthreads, depot_path)
+    use, intrinsic :: iso_c_binding, only: c_null_char
+    character(len=*), intent(in) :: project_directory
+    character(len=*), intent(in) :: sysimage_path
+    integer, intent(in), optional :: nthreads
+    integer, intent(in), optional :: ngcthreads
+    character(len=*), intent(in), optional :: depot_path
+    integer(c_int) :: nthreads_c, ngcthreads_c
+
+    ! Non-positive values are ignored by the C API
+    nthreads_c = 0
+    if (present(nthreads)) nthreads_c = nthreads
+    ngcthreads_c = 0
+    if (present(ngcthreads)) ngcthreads_c = ngcthreads
+
+    if (present(depot_path)) then
+      call trixi_initialize_with_sysimage_c(trim(adjustl(project_directory)) // &
+                                            c_null_char, &
+                                            trim(adjustl(depot_path)) // c_null_char, &
+                                            trim(adjustl(sysimage_path)) // c_null_char, &
+                                            nthreads_c, ngcthreads_c)
+    else
+      call trixi_initialize_with_sysimage_c(trim(adjustl(project_directory)) // &
+                                            c_null_char, &
+                                            sysimage_path=trim(adjustl(sysimage_path)) // &
+                                                          c_null_char, &
+                                            nthreads=nthreads_c, ngcthreads=ngcthreads_c)
+    end if
+  end subroutine
+
   !>
   !! @brief Return full version string of libtrixi (Fortran convenience version).
   !!
@@ -675,6 +1737,49 @@ module LibTrixi
     trixi_initialize_simulation = trixi_initialize_simulation_c(trim(adjustl(libelixir)) // c_null_char)
   end function
 
+  !>
+  !! @brief Set up Trixi simulation and continue from restart file (Fortran convenience
+  !!        version)
+  !!
+  !! @param[in]  libelixir         Path to libelexir file.
+  !! @param[in]  restart_filename  Path to restart file (without rank suffix).
+  !!
+  !! @return handle (integer) to Trixi simulation instance
+  !!
+  !! @see @ref trixi_initialize_simulation_from_restart_c::trixi_initialize_simulation_from_restart_c
+  !!           "trixi_initialize_simulation_from_restart_c (C char pointer version)"
+  !! @see @ref trixi_initialize_simulation_from_restart_api_c
+  !!           "trixi_initialize_simulation_from_restart (C API)"
+  integer(c_int) function trixi_initialize_simulation_from_restart(libelixir, &
+                                                                   restart_filename)
+    use, intrinsic :: iso_c_binding, only: c_int, c_null_char
+    character(len=*), intent(in) :: libelixir
+    character(len=*), intent(in) :: restart_filename
+
+    trixi_initialize_simulation_from_restart = &
+      trixi_initialize_simulation_from_restart_c(trim(adjustl(libelixir)) // c_null_char, &
+                                                 trim(adjustl(restart_filename)) // &
+                                                 c_null_char)
+  end function
+
+  !>
+  !! @brief Write restart file (Fortran convenience version)
+  !!
+  !! @param[in]  handle    simulation handle
+  !! @param[in]  filename  path to restart file (Fortran string)
+  !!
+  !! @see @ref trixi_write_restart_c::trixi_write_restart_c
+  !!           "trixi_write_restart_c (C char pointer version)"
+  !! @see @ref trixi_write_restart_api_c
+  !!           "trixi_write_restart (C API)"
+  subroutine trixi_write_restart(handle, filename)
+    use, intrinsic :: iso_c_binding, only: c_int, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: filename
+
+    call trixi_write_restart_c(handle, trim(adjustl(filename)) // c_null_char)
+  end subroutine
+
   !>
   !! @brief Check if simulation is finished (Fortran convenience version)
   !!
@@ -693,6 +1798,132 @@ module LibTrixi
     trixi_is_finished = trixi_is_finished_c(handle) == 1
   end function
 
+  !>
+  !! @brief Load multiple conservative variables (Fortran convenience version)
+  !!
+  !! The values of variable `variable_ids(i)` are stored in column `i` of `data`.
+  !!
+  !! @param[in]   handle        simulation handle
+  !! @param[in]   nvariables    number of variables to load
+  !! @param[in]   variable_ids  indices of variables
+  !! @param[out]  data          values for all degrees of freedom (size ndofs x nvariables)
+  !!
+  !! @see @ref trixi_load_conservative_vars_c::trixi_load_conservative_vars_c
+  !!           "trixi_load_conservative_vars_c (C pointer version)"
+  !! @see @ref trixi_load_conservative_vars_api_c
+  !!           "trixi_load_conservative_vars (C API)"
+  subroutine trixi_load_conservative_vars(handle, nvariables, variable_ids, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_ptr, c_loc
+    integer(c_int), intent(in) :: handle
+    integer(c_int), intent(in) :: nvariables
+    integer(c_int), dimension(nvariables), intent(in) :: variable_ids
+    real(c_double), dimension(:,:), contiguous, target, intent(out) :: data
+    type(c_ptr), dimension(nvariables) :: data_ptrs
+    integer :: i
+
+    ! Collect start addresses of all columns
+    do i = 1, nvariables
+      data_ptrs(i) = c_loc(data(1,i))
+    end do
+
+    call trixi_load_conservative_vars_c(handle, nvariables, variable_ids, data_ptrs)
+  end subroutine
+
+  !>
+  !! @brief Load multiple conservative variables in single precision (Fortran convenience
+  !!        version)
+  !!
+  !! The values of variable `variable_ids(i)` are stored in column `i` of `data`.
+  !!
+  !! @param[in]   handle        simulation handle
+  !! @param[in]   nvariables    number of variables to load
+  !! @param[in]   variable_ids  indices of variables
+  !! @param[out]  data          values for all degrees of freedom (size ndofs x nvariables)
+  !!
+  !! @see @ref trixi_load_conservative_vars_float_c::trixi_load_conservative_vars_float_c
+  !!           "trixi_load_conservative_vars_float_c (C pointer version)"
+  !! @see @ref trixi_load_conservative_vars_float_api_c
+  !!           "trixi_load_conservative_vars_float (C API)"
+  subroutine trixi_load_conservative_vars_float(handle, nvariables, variable_ids, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_float, c_ptr, c_loc
+    integer(c_int), intent(in) :: handle
+    integer(c_int), intent(in) :: nvariables
+    integer(c_int), dimension(nvariables), intent(in) :: variable_ids
+    real(c_float), dimension(:,:), contiguous, target, intent(out) :: data
+    type(c_ptr), dimension(nvariables) :: data_ptrs
+    integer :: i
+
+    ! Collect start addresses of all columns
+    do i = 1, nvariables
+      data_ptrs(i) = c_loc(data(1,i))
+    end do
+
+    call trixi_load_conservative_vars_float_c(handle, nvariables, variable_ids, data_ptrs)
+  end subroutine
+
+  !>
+  !! @brief Load multiple primitive variables (Fortran convenience version)
+  !!
+  !! The values of variable `variable_ids(i)` are stored in column `i` of `data`.
+  !!
+  !! @param[in]  handle        simulation handle
+  !! @param[in]  nvariables    number of variables to load
+  !! @param[in]  variable_ids  indices of variables
+  !! @param[out] data          values for all degrees of freedom (size ndofs x nvariables)
+  !!
+  !! @see @ref trixi_load_primitive_vars_c::trixi_load_primitive_vars_c
+  !!           "trixi_load_primitive_vars_c (C pointer version)"
+  !! @see @ref trixi_load_primitive_vars_api_c
+  !!           "trixi_load_primitive_vars (C API)"
+  subroutine trixi_load_primitive_vars(handle, nvariables, variable_ids, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_ptr, c_loc
+    integer(c_int), intent(in) :: handle
+    integer(c_int), intent(in) :: nvariables
+    integer(c_int), dimension(nvariables), intent(in) :: variable_ids
+    real(c_double), dimension(:,:), contiguous, target, intent(out) :: data
+    type(c_ptr), dimension(nvariables) :: data_ptrs
+    integer :: i
+
+    ! Collect start addresses of all columns
+    do i = 1, nvariables
+      data_ptrs(i) = c_loc(data(1,i))
+    end do
+
+    call trixi_load_primitive_vars_c(handle, nvariables, variable_ids, data_ptrs)
+  end subroutine
+
+  !>
+  !! @brief Load multiple primitive variables in single precision (Fortran convenience
+  !!        version)
+  !!
+  !! The values of variable `variable_ids(i)` are stored in column `i` of `data`.
+  !!
+  !! @param[in]  handle        simulation handle
+  !! @param[in]  nvariables    number of variables to load
+  !! @param[in]  variable_ids  indices of variables
+  !! @param[out] data          values for all degrees of freedom (size ndofs x nvariables)
+  !!
+  !! @see @ref trixi_load_primitive_vars_float_c::trixi_load_primitive_vars_float_c
+  !!           "trixi_load_primitive_vars_float_c (C pointer version)"
+  !! @see @ref trixi_load_primitive_vars_float_api_c
+  !!           "trixi_load_primitive_vars_float (C API)"
+  subroutine trixi_load_primitive_vars_float(handle, nvariables, variable_ids, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_float, c_ptr, c_loc
+    integer(c_int), intent(in) :: handle
+    integer(c_int), intent(in) :: nvariables
+    integer(c_int), dimension(nvariables), intent(in) :: variable_ids
+    real(c_float), dimension(:,:), contiguous, target, intent(out) :: data
+    type(c_ptr), dimension(nvariables) :: data_ptrs
+    integer :: i
+
+    ! Collect start addresses of all columns
+    do i = 1, nvariables
+      data_ptrs(i) = c_loc(data(1,i))
+    end do
+
+    call trixi_load_primitive_vars_float_c(handle, nvariables, variable_ids, data_ptrs)
+  end subroutine
+
   !>
   !! @brief Execute Julia code (Fortran convenience version)
   !!
@@ -708,6 +1939,143 @@ module LibTrixi
 
     call trixi_eval_julia_c(trim(adjustl(code)) // c_null_char)
   end subroutine
+
+  !>
+  !! @brief Return number of local faces on named boundary (Fortran convenience version)
+  !!
+  !! @param[in]  handle  simulation handle
+  !! @param[in]  name    boundary name (Fortran string)
+  !!
+  !! @return Number of local boundary faces
+  !!
+  !! @see @ref trixi_nboundary_faces_c::trixi_nboundary_faces_c
+  !!           "trixi_nboundary_faces_c (C char pointer version)"
+  !! @see @ref trixi_nboundary_faces_api_c
+  !!           "trixi_nboundary_faces (C API)"
+  integer(c_int) function trixi_nboundary_faces(handle, name)
+    use, intrinsic :: iso_c_binding, only: c_int, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+
+    trixi_nboundary_faces = trixi_nboundary_faces_c(handle, &
+                                                    trim(adjustl(name)) // c_null_char)
+  end function
+
+  !>
+  !! @brief Load element index of faces on named boundary (Fortran convenience version)
+  !!
+  !! @param[in]   handle    simulation handle
+  !! @param[in]   name      boundary name (Fortran string)
+  !! @param[out]  elements  element index of each boundary face (size nboundary_faces)
+  !!
+  !! @see @ref trixi_load_boundary_face_elements_c::trixi_load_boundary_face_elements_c
+  !!           "trixi_load_boundary_face_elements_c (C char pointer version)"
+  !! @see @ref trixi_load_boundary_face_elements_api_c
+  !!           "trixi_load_boundary_face_elements (C API)"
+  subroutine trixi_load_boundary_face_elements(handle, name, elements)
+    use, intrinsic :: iso_c_binding, only: c_int, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+    integer(c_int), dimension(*), intent(out) :: elements
+
+    call trixi_load_boundary_face_elements_c(handle, trim(adjustl(name)) // c_null_char, &
+                                             elements)
+  end subroutine
+
+  !>
+  !! @brief Load coordinates of nodes on named boundary (Fortran convenience version)
+  !!
+  !! @param[in]   handle  simulation handle
+  !! @param[in]   name    boundary name (Fortran string)
+  !! @param[out]  data    node coordinates (size ndims x nnodes^(ndims-1) x nboundary_faces)
+  !!
+  !! @see @ref
+  !!      trixi_load_boundary_node_coordinates_c::trixi_load_boundary_node_coordinates_c
+  !!           "trixi_load_boundary_node_coordinates_c (C char pointer version)"
+  !! @see @ref trixi_load_boundary_node_coordinates_api_c
+  !!           "trixi_load_boundary_node_coordinates (C API)"
+  subroutine trixi_load_boundary_node_coordinates(handle, name, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+    real(c_double), dimension(*), intent(out) :: data
+
+    call trixi_load_boundary_node_coordinates_c(handle, &
+                                                trim(adjustl(name)) // c_null_char, data)
+  end subroutine
+
+  !>
+  !! @brief Load conservative variable on named boundary (Fortran convenience version)
+  !!
+  !! @param[in]   handle       simulation handle
+  !! @param[in]   name         boundary name (Fortran string)
+  !! @param[in]   variable_id  index of variable
+  !! @param[out]  data         values at boundary nodes
+  !!                           (size nnodes^(ndims-1) x nboundary_faces)
+  !!
+  !! @see @ref
+  !!      trixi_load_boundary_conservative_var_c::trixi_load_boundary_conservative_var_c
+  !!           "trixi_load_boundary_conservative_var_c (C char pointer version)"
+  !! @see @ref trixi_load_boundary_conservative_var_api_c
+  !!           "trixi_load_boundary_conservative_var (C API)"
+  subroutine trixi_load_boundary_conservative_var(handle, name, variable_id, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+    integer(c_int), intent(in) :: variable_id
+    real(c_double), dimension(*), intent(out) :: data
+
+    call trixi_load_boundary_conservative_var_c(handle, &
+                                                trim(adjustl(name)) // c_null_char, &
+                                                variable_id, data)
+  end subroutine
+
+  !>
+  !! @brief Load primitive variable on named boundary (Fortran convenience version)
+  !!
+  !! @param[in]   handle       simulation handle
+  !! @param[in]   name         boundary name (Fortran string)
+  !! @param[in]   variable_id  index of variable
+  !! @param[out]  data         values at boundary nodes
+  !!                           (size nnodes^(ndims-1) x nboundary_faces)
+  !!
+  !! @see @ref trixi_load_boundary_primitive_var_c::trixi_load_boundary_primitive_var_c
+  !!           "trixi_load_boundary_primitive_var_c (C char pointer version)"
+  !! @see @ref trixi_load_boundary_primitive_var_api_c
+  !!           "trixi_load_boundary_primitive_var (C API)"
+  subroutine trixi_load_boundary_primitive_var(handle, name, variable_id, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+    integer(c_int), intent(in) :: variable_id
+    real(c_double), dimension(*), intent(out) :: data
+
+    call trixi_load_boundary_primitive_var_c(handle, trim(adjustl(name)) // c_null_char, &
+                                             variable_id, data)
+  end subroutine
+
+  !>
+  !! @brief Register outer boundary states for named boundary (Fortran convenience version)
+  !!
+  !! The array `data` must remain valid (and should have the `target` attribute) as long as
+  !! it might be accessed by the simulation.
+  !!
+  !! @param[in]  handle  simulation handle
+  !! @param[in]  name    boundary name (Fortran string)
+  !! @param[in]  data    outer states (size nvariables x nnodes^(ndims-1) x nboundary_faces)
+  !!
+  !! @see @ref trixi_register_boundary_data_c::trixi_register_boundary_data_c
+  !!           "trixi_register_boundary_data_c (C char pointer version)"
+  !! @see @ref trixi_register_boundary_data_api_c
+  !!           "trixi_register_boundary_data (C API)"
+  subroutine trixi_register_boundary_data(handle, name, data)
+    use, intrinsic :: iso_c_binding, only: c_int, c_double, c_null_char
+    integer(c_int), intent(in) :: handle
+    character(len=*), intent(in) :: name
+    real(c_double), dimension(*), intent(in), target :: data
+
+    call trixi_register_boundary_data_c(handle, trim(adjustl(name)) // c_null_char, data)
+  end subroutine
   
 end module
 
@@ -1,6 +1,7 @@
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "auxiliary.h"
 
@@ -52,6 +53,56 @@ void update_depot_path(const char * project_directory, const char * depot_path)
 }
 
 
+// Helper function to set environment variables for the number of Julia threads
+// Note: These are evaluated by Julia during initialization and thus need to be set before
+void update_thread_count(int nthreads, int ngcthreads) {
+    // Verify that buffer size is large enough for any int
+    char value[32];
+
+    // Only set number of threads if a positive value is given
+    if (nthreads > 0) {
+        snprintf(value, 32, "%d", nthreads);
+        setenv("JULIA_NUM_THREADS", value, 1);
+        if (show_debug_output()) {
+            printf("JULIA_NUM_THREADS set to \"%s\"\n", value);
+        }
+    }
+
+    // Only set number of GC threads if a positive value is given
+    if (ngcthreads > 0) {
+        snprintf(value, 32, "%d", ngcthreads);
+        setenv("JULIA_NUM_GC_THREADS", value, 1);
+        if (show_debug_output()) {
+            printf("JULIA_NUM_GC_THREADS set to \"%s\"\n", value);
+        }
+    }
+}
+
+
+// Helper function to determine the directory of the Julia executable
+// Note: This is required by `jl_init_with_image` and determined in the same way as by
+//       `jl_init`, i.e., relative to the location of libjulia
+void get_julia_bindir(char * bindir, int size) {
+    const char * libdir = jl_get_libdir();
+
+    // Verify that buffer size is large enough (+1 for trailing null)
+    const char * relative_bindir = "/../bin";
+    if ( (int)(strlen(libdir) + strlen(relative_bindir) + 1) > size ) {
+        print_and_die("buffer size not sufficient for Julia bin directory", LOC);
+    }
+
+    snprintf(bindir, size, "%s%s", libdir, relative_bindir);
+}
+
+
+// Helper function to get the wall clock time in seconds
+double wall_time() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1.0e-9 * ts.tv_nsec;
+}
+
+
 // Function for more helpful error messages
 void print_and_die(const char* message, const char* func, const char* file, int lineno) {
     fprintf(stderr, "ERROR in %s:%d (%s): %s\n", file, lineno, func, message);
@@ -6,6 +6,15 @@
 // Helper function to set JULIA_DEPOT_PATH environment variable
 void update_depot_path(const char * project_directory, const char * depot_path);
 
+// Helper function to set environment variables for the number of Julia threads
+void update_thread_count(int nthreads, int ngcthreads);
+
+// Helper function to determine the directory of the Julia executable
+void get_julia_bindir(char * bindir, int size);
+
+// Helper function to get the wall clock time in seconds
+double wall_time();
+
 // Function for more helpful error messages
 #define LOC __func__, __FILE__, __LINE__
 void print_and_die(const char* message, const char* func, const char* file, int lineno);
@@ -6,9 +6,77 @@
  * @{
 */
 
+// Version of the state layout description, incremented on incompatible changes
+#define TRIXI_STATE_LAYOUT_VERSION 1
+
+/**
+ * @brief Layout description of the internal state array
+ *
+ * The value of variable `v` at node `n` of element `e` (all zero-based) is located at
+ * `data[v * variable_stride + n * node_stride + e * element_stride]`. Strides are given in
+ * units of `double`.
+ */
+typedef struct trixi_state_layout {
+    double * data;        ///< pointer to the beginning of the internal state array
+    int version;          ///< layout version, see `TRIXI_STATE_LAYOUT_VERSION`
+    int ndims;            ///< number of spatial dimensions
+    int nnodes;           ///< number of quadrature nodes per dimension
+    int nvariables;       ///< number of conservative variables
+    int ndofselement;     ///< number of nodes per element
+    int nelements;        ///< number of local elements
+    int variable_stride;  ///< distance between consecutive variables of a node
+    int node_stride;      ///< distance between consecutive nodes of an element
+    int element_stride;   ///< distance between consecutive elements
+} trixi_state_layout_t;
+
+/**
+ * @brief Wall clock times of the initialization phases in seconds
+ *
+ * Filled by `trixi_get_startup_times` after libtrixi has been initialized.
+ */
+typedef struct trixi_startup_times {
+    double julia_init;         ///< initializing the Julia runtime and loading the sysimage
+    double activate;           ///< activating the Julia project (zero if skipped)
+    double load_packages;      ///< loading LibTrixi.jl and its dependencies
+    double function_pointers;  ///< retrieving the function pointers of the C API
+    double total;              ///< complete initialization
+    int sysimage_packages;     ///< 1 if LibTrixi.jl was provided by the sysimage, else 0
+} trixi_startup_times_t;
+
+/**
+ * @brief Signature of source term functions called during the right-hand side evaluation
+ *
+ * The arrays `u` and `du` have the layout described by `trixi_state_layout_t`. The array
+ * `node_coordinates` holds the `ndims` physical coordinates of each node, i.e., coordinate
+ * `d` of node `n` of element `e` is located at
+ * `node_coordinates[d + ndims * (n + ndofselement * e)]`. Source terms have to be *added*
+ * to `du`.
+ */
+typedef void (*trixi_source_terms_t)(double time, const double * u, double * du,
+                                     const double * node_coordinates, int nelements,
+                                     void * userdata);
+
+/**
+ * @brief Signature of functions notified about mesh changes
+ *
+ * `epoch` is the new mesh epoch as returned by `trixi_mesh_epoch`, `nelements_old` and
+ * `nelements_new` are the numbers of local elements before and after the change.
+ */
+typedef void (*trixi_mesh_change_callback_t)(int epoch, int nelements_old,
+                                             int nelements_new, void * userdata);
+
 // Setup
 void trixi_initialize(const char * project_directory, const char * depot_path);
+void trixi_initialize_with_threads(const char * project_directory, const char * depot_path,
+                                   int nthreads, int ngcthreads);
+void trixi_initialize_with_sysimage(const char * project_directory, const char * depot_path,
+                                    const char * sysimage_path, int nthreads,
+                                    int ngcthreads);
+void trixi_get_startup_times(trixi_startup_times_t * times);
 void trixi_finalize();
+int trixi_nthreads();
+int trixi_gc_safe_enter();
+void trixi_gc_safe_leave(int state);
 
 // Version information
 int trixi_version_library_major();
@@ -23,11 +91,23 @@ int trixi_initialize_simulation(const char * libelixir);
 void trixi_finalize_simulation(int handle);
 int trixi_is_finished(int handle);
 void trixi_step(int handle);
+int trixi_step_n(int handle, int nsteps, double * time);
+int trixi_advance_to_time(int handle, double target_time, double * time);
+int trixi_rebalance(int handle, const double * element_weights);
+int trixi_save_state_size(int handle);
+void trixi_save_state(int handle, double * buffer);
+void trixi_restore_state(int handle, const double * buffer);
+void trixi_checkpoint_async(int handle);
+void trixi_checkpoint_wait(int handle);
+void trixi_write_restart(int handle, const char * filename);
+int trixi_initialize_simulation_from_restart(const char * libelixir,
+                                             const char * restart_filename);
 
 // Simulation data
 int trixi_ndims(int handle);
 int trixi_nelements(int handle);
 int trixi_nelementsglobal(int handle);
+int trixi_element_global_offset(int handle);
 int trixi_ndofs(int handle);
 int trixi_ndofsglobal(int handle);
 int trixi_ndofselement(int handle);
@@ -37,18 +117,63 @@ double trixi_calculate_dt(int handle);
 double trixi_get_simulation_time(int handle);
 void trixi_load_node_reference_coordinates(int handle, double* node_coords);
 void trixi_load_node_weights(int handle, double* node_weights);
+void trixi_load_node_coordinates(int handle, double* node_coords);
 void trixi_load_conservative_var(int handle, int variable_id, double * data);
+void trixi_load_conservative_vars(int handle, int nvariables, const int * variable_ids,
+                                  double ** data);
 void trixi_load_primitive_var(int handle, int variable_id, double * data);
+void trixi_load_primitive_vars(int handle, int nvariables, const int * variable_ids,
+                               double ** data);
 void trixi_load_element_averaged_primitive_var(int handle, int variable_id, double * data);
+void trixi_load_conservative_var_float(int handle, int variable_id, float * data);
+void trixi_load_conservative_vars_float(int handle, int nvariables,
+                                        const int * variable_ids, float ** data);
+void trixi_load_primitive_var_float(int handle, int variable_id, float * data);
+void trixi_load_primitive_vars_float(int handle, int nvariables, const int * variable_ids,
+                                     float ** data);
+void trixi_load_element_averaged_primitive_var_float(int handle, int variable_id,
+                                                     float * data);
 void trixi_store_conservative_var(int handle, int variable_id, double * data);
+void trixi_load_conservative_var_elements(int handle, int variable_id, int nelements,
+                                          const int * elements, double * data);
+void trixi_load_primitive_var_elements(int handle, int variable_id, int nelements,
+                                       const int * elements, double * data);
+void trixi_store_conservative_var_elements(int handle, int variable_id, int nelements,
+                                           const int * elements, const double * data);
+int trixi_nboundary_faces(int handle, const char * name);
+void trixi_load_boundary_face_elements(int handle, const char * name, int * elements);
+void trixi_load_boundary_node_coordinates(int handle, const char * name, double * data);
+void trixi_load_boundary_conservative_var(int handle, const char * name, int variable_id,
+                                          double * data);
+void trixi_load_boundary_primitive_var(int handle, const char * name, int variable_id,
+                                       double * data);
 void trixi_register_data(int handle, int index, int size, const double * data);
+void trixi_register_boundary_data(int handle, const char * name, const double * data);
+double * trixi_registry_alloc(int handle, int index, int ncomponents);
+double * trixi_registry_get_pointer(int handle, int index);
+void trixi_register_source_terms(int handle, trixi_source_terms_t source_terms,
+                                 void * userdata);
+void trixi_set_refinement_indicator(int handle, const double * indicator);
+int trixi_mesh_epoch(int handle);
+void trixi_register_mesh_change_callback(int handle, trixi_mesh_change_callback_t callback,
+                                         void * userdata);
 double * trixi_get_conservative_vars_pointer(int handle);
+const double * trixi_get_node_coordinates_pointer(int handle);
+void trixi_get_state_layout(int handle, trixi_state_layout_t * layout);
+double trixi_integrate_var(int handle, int variable_id);
+void trixi_norm_var(int handle, int variable_id, double * l2, double * linf);
+void trixi_minmax_var(int handle, int variable_id, double * min, double * max);
+int trixi_probe_create(int handle, int npoints, const double * xyz);
+void trixi_probe_eval(int handle, int probe, int nvariables, const int * variable_ids,
+                      double * data);
+void trixi_probe_free(int handle, int probe);
 
 // T8code
 #if !defined(T8_H) && !defined(T8_FOREST_GENERAL_H)
 typedef struct t8_forest *t8_forest_t;
 #endif
 t8_forest_t trixi_get_t8code_forest(int handle);
+void trixi_load_element_tree_map(int handle, int * tree_ids, int * local_ids);
 
 // Misc
 void trixi_eval_julia(const char * code);
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 extern "C" {
     #include "../src/trixi.h"
@@ -91,6 +93,148 @@ TEST(CInterfaceTest, VersionInfo) {
 }
 
 
+TEST(CInterfaceTest, Threads) {
+
+    // Initialize libtrixi with explicit number of threads
+    trixi_initialize_with_threads( julia_project_path, NULL, 2, 1 );
+
+    // Check number of Julia threads
+    EXPECT_EQ(trixi_nthreads(), 2);
+
+    // Finalize libtrixi
+    trixi_finalize();
+}
+
+
+TEST(CInterfaceTest, StartupTimes) {
+
+    // No times are available before initialization
+    trixi_startup_times_t times;
+    trixi_get_startup_times(&times);
+    EXPECT_EQ(times.total, 0.0);
+
+    // Initialize libtrixi with default system image
+    trixi_initialize_with_sysimage( julia_project_path, NULL, NULL, 0, 0 );
+
+    // Packages are not part of the default system image and need to be activated
+    trixi_get_startup_times(&times);
+    EXPECT_EQ(times.sysimage_packages, 0);
+    EXPECT_GT(times.julia_init, 0.0);
+    EXPECT_GT(times.activate, 0.0);
+    EXPECT_GT(times.load_packages, 0.0);
+    EXPECT_GT(times.function_pointers, 0.0);
+    EXPECT_NEAR(times.julia_init + times.activate + times.load_packages +
+                times.function_pointers, times.total, 1.0e-6 * times.total);
+
+    // Finalize libtrixi
+    trixi_finalize();
+}
+
+
+TEST(CInterfaceTest, ConcurrentSimulations) {
+
+    // Output callbacks are not thread-safe, thus use a libelixir without them
+    const char * libelixir_path =
+      "../../../LibTrixi.jl/examples/libelixir_tree1d_advection_source_terms.jl";
+
+    // Initialize libtrixi
+    trixi_initialize( julia_project_path, NULL );
+
+    // Trixi.jl's global timer is not thread-safe
+    trixi_eval_julia("using Trixi; Trixi.TimerOutputs.disable_debug_timings(Trixi)");
+
+    // Set up independent simulations
+    const int nsimulations = 2;
+    int handles[nsimulations];
+    for (int i = 0; i < nsimulations; ++i) {
+        handles[i] = trixi_initialize_simulation( libelixir_path );
+    }
+
+    // Step each simulation to completion in a separate (foreign) thread
+    double times[nsimulations];
+    std::thread threads[nsimulations];
+    for (int i = 0; i < nsimulations; ++i) {
+        threads[i] = std::thread([&handles, &times, i]() {
+            while (!trixi_is_finished(handles[i])) {
+                trixi_step(handles[i]);
+            }
+            times[i] = trixi_get_simulation_time(handles[i]);
+        });
+    }
+
+    // Blocking while joining requires the main thread to be GC-safe
+    int gc_state = trixi_gc_safe_enter();
+    for (int i = 0; i < nsimulations; ++i) {
+        threads[i].join();
+    }
+    trixi_gc_safe_leave(gc_state);
+
+    // Both simulations must have reached the final time
+    for (int i = 0; i < nsimulations; ++i) {
+        EXPECT_DOUBLE_EQ(times[i], 1.0);
+        trixi_finalize_simulation(handles[i]);
+    }
+
+    // Finalize libtrixi
+    trixi_finalize();
+}
+
+
+TEST(CInterfaceTest, BoundaryData) {
+
+    const char * libelixir_path =
+      "../../../LibTrixi.jl/examples/libelixir_p4est2d_advection_boundary_data.jl";
+
+    // Initialize libtrixi
+    trixi_initialize( julia_project_path, NULL );
+
+    // Set up the Trixi simulation, get a handle
+    int handle = trixi_initialize_simulation( libelixir_path );
+
+    // 4x4 trees with periodic y-direction, i.e., four faces on each x-boundary
+    const int nfaces = trixi_nboundary_faces(handle, "x_neg");
+    EXPECT_EQ(nfaces, 4);
+    EXPECT_EQ(trixi_nboundary_faces(handle, "x_pos"), 4);
+    const int nboundary_nodes = nfaces * trixi_nnodes(handle);
+
+    // Faces belong to distinct elements at the left side of the domain
+    std::vector<int> elements(nfaces);
+    trixi_load_boundary_face_elements(handle, "x_neg", elements.data());
+    for (int i = 1; i < nfaces; ++i) {
+        EXPECT_NE(elements[i], elements[i-1]);
+    }
+    std::vector<double> coordinates(2 * nboundary_nodes);
+    trixi_load_boundary_node_coordinates(handle, "x_neg", coordinates.data());
+    for (int i = 0; i < nboundary_nodes; ++i) {
+        EXPECT_DOUBLE_EQ(coordinates[2 * i], -1.0);
+    }
+
+    // Initial condition is constant
+    std::vector<double> data(nboundary_nodes);
+    trixi_load_boundary_conservative_var(handle, "x_neg", 1, data.data());
+    for (int i = 0; i < nboundary_nodes; ++i) {
+        EXPECT_DOUBLE_EQ(data[i], 2.0);
+    }
+    trixi_load_boundary_primitive_var(handle, "x_neg", 1, data.data());
+    EXPECT_DOUBLE_EQ(data[0], 2.0);
+
+    // Inflow of a larger state increases the solution at the inflow boundary
+    std::vector<double> boundary_data(nboundary_nodes, 3.0);
+    trixi_register_boundary_data(handle, "x_neg", boundary_data.data());
+    trixi_step_n(handle, 10, NULL);
+    trixi_load_boundary_conservative_var(handle, "x_neg", 1, data.data());
+    for (int i = 0; i < nboundary_nodes; ++i) {
+        EXPECT_GT(data[i], 2.0);
+    }
+
+    // Finalize Trixi simulation
+    trixi_finalize_simulation(handle);
+
+    // Finalize libtrixi
+    trixi_finalize();
+}
+
+
 TEST(CInterfaceTest, JuliaCode) {
 
     // Initialize libtrixi
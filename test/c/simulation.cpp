@@ -1,3 +1,4 @@
+#include <cmath>
 #include <gtest/gtest.h>
 #include <mpi.h>
 
@@ -46,10 +47,26 @@ TEST(CInterfaceTest, SimulationRun) {
     EXPECT_DEATH(trixi_register_data(handle, 2, 3, test_data.data()),
                  "BoundsError");
 
-    // Do 10 simulation steps
-    for (int i = 0; i < 10; ++i) {
+    // Do 10 simulation steps, the last five in a single call
+    for (int i = 0; i < 5; ++i) {
         trixi_step(handle);
     }
+    double time_step_n = 0.0;
+    int nsteps = trixi_step_n(handle, 5, &time_step_n);
+    EXPECT_EQ(nsteps, 5);
+
+    // Save a snapshot, do two more steps, and roll back
+    int snapshot_size = trixi_save_state_size(handle);
+    std::vector<double> snapshot(snapshot_size);
+    trixi_save_state(handle, snapshot.data());
+    trixi_step_n(handle, 2, NULL);
+    EXPECT_GT(trixi_get_simulation_time(handle), time_step_n);
+    trixi_restore_state(handle, snapshot.data());
+    EXPECT_DOUBLE_EQ(trixi_get_simulation_time(handle), time_step_n);
+
+    // Write a checkpoint (in the background only for serial runs with several threads)
+    trixi_checkpoint_async(handle);
+    trixi_checkpoint_wait(handle);
 
     // Check time step length
     double dt = trixi_calculate_dt(handle);
@@ -58,6 +75,7 @@ TEST(CInterfaceTest, SimulationRun) {
     // Check time
     double time = trixi_get_simulation_time(handle);
     EXPECT_NEAR(time, 0.0304927240859461, 1e-16);
+    EXPECT_DOUBLE_EQ(time, time_step_n);
     
     // Check finished status
     int finished_status = trixi_is_finished(handle);
@@ -72,6 +90,14 @@ TEST(CInterfaceTest, SimulationRun) {
     int nelementsglobal = trixi_nelementsglobal(handle);
     EXPECT_EQ(nelements * nranks, nelementsglobal);
 
+    // Check global element offset
+    int element_offset = 0;
+    MPI_Exscan(&nelements, &element_offset, 1, MPI_INT, MPI_SUM, comm);
+    if (rank == 0) {
+        element_offset = 0;
+    }
+    EXPECT_EQ(trixi_element_global_offset(handle), element_offset);
+
     // Check number of dofs
     int ndofs = trixi_ndofs(handle);
     int ndofsglobal = trixi_ndofsglobal(handle);
@@ -100,6 +126,16 @@ TEST(CInterfaceTest, SimulationRun) {
     }
     EXPECT_NEAR(integral, 0.4, 1e-17);
 
+    // Check physical node coordinates, domain is [-1,1]^2
+    std::vector<double> node_coords(ndims * ndofs);
+    trixi_load_node_coordinates(handle, node_coords.data());
+    const double * node_coords_ptr = trixi_get_node_coordinates_pointer(handle);
+    for (int i = 0; i < ndims * ndofs; ++i) {
+        EXPECT_GE(node_coords[i], -1.0);
+        EXPECT_LE(node_coords[i],  1.0);
+        EXPECT_DOUBLE_EQ(node_coords[i], node_coords_ptr[i]);
+    }
+
     // Check conservative variable values
     std::vector<double> rho(ndofs);
     std::vector<double> rho_energy(ndofs);
@@ -111,6 +147,15 @@ TEST(CInterfaceTest, SimulationRun) {
     EXPECT_DOUBLE_EQ(rho_energy[0],       2.5e-5);
     EXPECT_DOUBLE_EQ(rho_energy[ndofs-1], 2.5e-5);
 
+    // Check loading multiple conservative variables at once
+    std::vector<double> rho_multi(ndofs);
+    std::vector<double> rho_energy_multi(ndofs);
+    const int variable_ids[2] = {1, 4};
+    double * data_multi[2] = {rho_multi.data(), rho_energy_multi.data()};
+    trixi_load_conservative_vars(handle, 2, variable_ids, data_multi);
+    EXPECT_EQ(rho_multi, rho);
+    EXPECT_EQ(rho_energy_multi, rho_energy);
+
     // Check primitive variable values
     std::vector<double> energy(ndofs);
     trixi_load_primitive_var(handle, 1, rho.data());
@@ -121,6 +166,14 @@ TEST(CInterfaceTest, SimulationRun) {
     EXPECT_DOUBLE_EQ(energy[0],       1.0e-5);
     EXPECT_DOUBLE_EQ(energy[ndofs-1], 1.0e-5);
 
+    // Check loading multiple primitive variables at once
+    std::vector<double> rho_prim_multi(ndofs);
+    std::vector<double> energy_multi(ndofs);
+    double * prim_multi[2] = {rho_prim_multi.data(), energy_multi.data()};
+    trixi_load_primitive_vars(handle, 2, variable_ids, prim_multi);
+    EXPECT_EQ(rho_prim_multi, rho);
+    EXPECT_EQ(energy_multi, energy);
+
     // Check element averaged values
     std::vector<double> rho_averages(nelements);
     std::vector<double> v1_averages(nelements);
@@ -176,6 +229,50 @@ TEST(CInterfaceTest, SimulationRun) {
         FAIL() << "Test cannot be run with " << nranks << " ranks.";
     }
 
+    // Check single precision variants
+    std::vector<float> rho_float(ndofs);
+    std::vector<float> energy_float(ndofs);
+    std::vector<float> rho_averages_float(nelements);
+    trixi_load_conservative_var_float(handle, 1, rho_float.data());
+    for (int i = 0; i < ndofs; ++i) {
+        EXPECT_EQ(rho_float[i], static_cast<float>(rho[i]));
+    }
+    float * prim_multi_float[2] = {rho_float.data(), energy_float.data()};
+    trixi_load_primitive_vars_float(handle, 2, variable_ids, prim_multi_float);
+    for (int i = 0; i < ndofs; ++i) {
+        EXPECT_EQ(rho_float[i],    static_cast<float>(rho[i]));
+        EXPECT_EQ(energy_float[i], static_cast<float>(energy[i]));
+    }
+    trixi_load_element_averaged_primitive_var_float(handle, 1, rho_averages_float.data());
+    for (int i = 0; i < nelements; ++i) {
+        EXPECT_EQ(rho_averages_float[i], static_cast<float>(rho_averages[i]));
+    }
+
+    // Check global reductions, mass is conserved on the periodic domain [-1,1]^2
+    EXPECT_NEAR(trixi_integrate_var(handle, 1), 4.0, 1e-12);
+    double rho_min, rho_max, rho_l2, rho_linf;
+    trixi_minmax_var(handle, 1, &rho_min, &rho_max);
+    trixi_norm_var(handle, 1, &rho_l2, &rho_linf);
+    for (int i = 0; i < ndofs; ++i) {
+        EXPECT_LE(rho_min, rho[i]);
+        EXPECT_GE(rho_max, rho[i]);
+    }
+    EXPECT_DOUBLE_EQ(rho_linf, rho_max);
+    EXPECT_GE(rho_l2, rho_min);
+    EXPECT_LE(rho_l2, rho_max);
+
+    // Check probes, density is still unperturbed far away from the blast
+    const double probe_points[4] = {-0.99, -0.99, 2.0, 2.0};
+    const int probe = trixi_probe_create(handle, 2, probe_points);
+    const int probe_variable_ids[2] = {1, 4};
+    double probe_data[4];
+    trixi_probe_eval(handle, probe, 2, probe_variable_ids, probe_data);
+    EXPECT_NEAR(probe_data[0], 1.0, 1e-12);
+    EXPECT_NEAR(probe_data[2], 2.5e-5, 1e-12);
+    EXPECT_TRUE(std::isnan(probe_data[1]));
+    EXPECT_TRUE(std::isnan(probe_data[3]));
+    trixi_probe_free(handle, probe);
+
     // Check storing of conservative variables
     rho[0] = 42.0;
     rho[ndofs-1] = 23.0;
@@ -185,6 +282,43 @@ TEST(CInterfaceTest, SimulationRun) {
     EXPECT_DOUBLE_EQ(rho[0],       raw_data[0]);
     EXPECT_DOUBLE_EQ(rho[ndofs-1], raw_data[4*(ndofs-1)]);
 
+    // Check layout description of raw data
+    trixi_state_layout_t layout;
+    trixi_get_state_layout(handle, &layout);
+    EXPECT_EQ(layout.data, raw_data);
+    EXPECT_EQ(layout.version, TRIXI_STATE_LAYOUT_VERSION);
+    EXPECT_EQ(layout.ndims, ndims);
+    EXPECT_EQ(layout.nnodes, nnodes);
+    EXPECT_EQ(layout.nvariables, nvariables);
+    EXPECT_EQ(layout.ndofselement, ndofselement);
+    EXPECT_EQ(layout.nelements, nelements);
+    const int last_dof = (nelements-1) * layout.element_stride +
+                         (ndofselement-1) * layout.node_stride;
+    EXPECT_DOUBLE_EQ(rho[ndofs-1], layout.data[last_dof]);
+
+    // Rebalance with more expensive elements on the last rank, mass is moved along
+    const double mass = trixi_integrate_var(handle, 1);
+    const int mesh_epoch = trixi_mesh_epoch(handle);
+    std::vector<double> element_weights(nelements, rank == nranks - 1 ? 3.0 : 1.0);
+    const int nelements_rebalanced = trixi_rebalance(handle, element_weights.data());
+    EXPECT_EQ(nelements_rebalanced, trixi_nelements(handle));
+    EXPECT_EQ(trixi_nelementsglobal(handle), nelementsglobal);
+    EXPECT_NEAR(trixi_integrate_var(handle, 1), mass, 1e-12);
+    if (nranks == 1) {
+        EXPECT_EQ(nelements_rebalanced, nelements);
+        EXPECT_EQ(trixi_mesh_epoch(handle), mesh_epoch);
+    }
+    else {
+        if (rank == nranks - 1) {
+            EXPECT_LT(nelements_rebalanced, nelements);
+        }
+        else {
+            EXPECT_GT(nelements_rebalanced, nelements);
+        }
+        EXPECT_EQ(trixi_mesh_epoch(handle), mesh_epoch + 1);
+    }
+    trixi_step(handle);
+
     // Finalize Trixi simulation
     trixi_finalize_simulation(handle);
 
@@ -11,6 +11,22 @@ const char * julia_project_path = JULIA_PROJECT_PATH;
 const char * libelixir_path =
   "../../../LibTrixi.jl/examples/libelixir_t8code2d_euler_tracer_amr.jl";
 
+// Record mesh change notifications
+struct MeshChanges {
+    int ncalls = 0;
+    int epoch = 0;
+    int nelements_old = 0;
+    int nelements_new = 0;
+};
+
+void record_mesh_change(int epoch, int nelements_old, int nelements_new, void * userdata) {
+    MeshChanges * changes = static_cast<MeshChanges *>(userdata);
+    changes->ncalls++;
+    changes->epoch = epoch;
+    changes->nelements_old = nelements_old;
+    changes->nelements_new = nelements_new;
+}
+
 TEST(CInterfaceTest, T8code) {
 
     // Initialize libtrixi
@@ -22,7 +38,62 @@ TEST(CInterfaceTest, T8code) {
     // Check t8code mesh
     t8_forest_t trixi_forest = trixi_get_t8code_forest(handle);
     EXPECT_NE(trixi_forest, nullptr);
-    
+
+    // Check physical node coordinates
+    const int ndims = trixi_ndims(handle);
+    const int ndofs = trixi_ndofs(handle);
+    std::vector<double> node_coords(ndims * ndofs);
+    trixi_load_node_coordinates(handle, node_coords.data());
+    const double * node_coords_ptr = trixi_get_node_coordinates_pointer(handle);
+    EXPECT_DOUBLE_EQ(node_coords[0], node_coords_ptr[0]);
+    EXPECT_DOUBLE_EQ(node_coords[ndims * ndofs - 1], node_coords_ptr[ndims * ndofs - 1]);
+
+    // Check mesh change notifications, the AMR callback is triggered every 50 steps
+    EXPECT_EQ(trixi_mesh_epoch(handle), 0);
+    MeshChanges changes;
+    const int nelements_initial = trixi_nelements(handle);
+    trixi_register_mesh_change_callback(handle, record_mesh_change, &changes);
+
+    // Registry fields are transferred to the new mesh, linear data is preserved exactly
+    double * field = trixi_registry_alloc(handle, 1, ndims);
+    for (int i = 0; i < ndims * ndofs; ++i) {
+        field[i] = node_coords[i];
+    }
+
+    trixi_step_n(handle, 50, NULL);
+    EXPECT_GE(changes.ncalls, 1);
+    EXPECT_EQ(changes.ncalls, trixi_mesh_epoch(handle));
+    EXPECT_EQ(changes.epoch, trixi_mesh_epoch(handle));
+    EXPECT_EQ(changes.nelements_new, trixi_nelements(handle));
+    if (changes.ncalls == 1) {
+        EXPECT_EQ(changes.nelements_old, nelements_initial);
+    }
+
+    const int ndofs_new = trixi_ndofs(handle);
+    std::vector<double> node_coords_new(ndims * ndofs_new);
+    trixi_load_node_coordinates(handle, node_coords_new.data());
+    field = trixi_registry_get_pointer(handle, 1);
+    for (int i = 0; i < ndims * ndofs_new; ++i) {
+        EXPECT_NEAR(field[i], node_coords_new[i], 1e-10);
+    }
+
+    // Check map from elements to forest, elements are stored tree by tree
+    const int nelements = trixi_nelements(handle);
+    std::vector<int> tree_ids(nelements);
+    std::vector<int> local_ids(nelements);
+    trixi_load_element_tree_map(handle, tree_ids.data(), local_ids.data());
+    EXPECT_EQ(tree_ids[0], 0);
+    EXPECT_EQ(local_ids[0], 0);
+    for (int i = 1; i < nelements; ++i) {
+        if (tree_ids[i] == tree_ids[i-1]) {
+            EXPECT_EQ(local_ids[i], local_ids[i-1] + 1);
+        } else {
+            EXPECT_EQ(tree_ids[i], tree_ids[i-1] + 1);
+            EXPECT_EQ(local_ids[i], 0);
+        }
+    }
+    EXPECT_EQ(trixi_element_global_offset(handle), 0);
+
     // Finalize Trixi simulation
     trixi_finalize_simulation(handle);
 
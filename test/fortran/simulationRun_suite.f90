@@ -30,8 +30,10 @@ module simulationRun_suite
     integer, parameter :: dp = selected_real_kind(15)
     real(dp) :: dt, time, integral
     real(dp), dimension(:), allocatable :: data, weights
+    real(dp), dimension(:,:), allocatable :: data_multi
     type(c_ptr) :: raw_data_c
     real(c_double), dimension(:), pointer :: raw_data
+    type(trixi_state_layout) :: layout
 
     ! Initialize Trixi
     call trixi_initialize(julia_project_path)
@@ -110,6 +112,13 @@ module simulationRun_suite
     call check(error, data(3200), 1.0_dp)
     call check(error, data(size), 1.0_dp)
 
+    ! Check loading multiple conservative variables at once
+    allocate(data_multi(size, 2))
+    call trixi_load_conservative_vars(handle, 2, [1, 4], data_multi)
+    call check(error, data_multi(1,1),    data(1))
+    call check(error, data_multi(size,1), data(size))
+    deallocate(data_multi)
+
     ! Check primitive variable values
     call trixi_load_primitive_var(handle, 1, data)
     call check(error, data(1),    1.0_dp)
@@ -135,6 +144,16 @@ module simulationRun_suite
     call check(error, data(1),     raw_data(1))
     call check(error, data(ndofs), raw_data(4*ndofs - 3))
 
+    ! Check layout description of raw data
+    call trixi_get_state_layout(handle, layout)
+    call check(error, layout%version, TRIXI_STATE_LAYOUT_VERSION)
+    call check(error, layout%nvariables, nvariables)
+    call check(error, layout%nelements, nelements)
+    call check(error, layout%ndofselement, ndofselement)
+    call check(error, layout%variable_stride, 1)
+    call check(error, layout%node_stride, nvariables)
+    call check(error, layout%element_stride, nvariables * ndofselement)
+
     deallocate(data)
 
     ! Finalize Trixi simulation